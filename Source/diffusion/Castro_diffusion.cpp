@@ -77,6 +77,167 @@ Castro::construct_new_diff_source(MultiFab& source, MultiFab& state_old, MultiFa
     }
 }
 
+void
+Castro::do_sts_diffusion (Real time, Real dt)
+{
+    BL_PROFILE("Castro::do_sts_diffusion()");
+
+    const Real strt_time = ParallelDescriptor::second();
+
+    MultiFab& S_new = get_new_data(State_Type);
+
+    // The number of stages is set by the explicit diffusion timestep of
+    // the current state, using the same safety factor as estTimeStep.
+    // An RKL2 update with s stages is stable for
+    //
+    //   dt <= dt_expl (s**2 + s - 2) / 4
+    //
+    // We do not cap s at diffuse_sts_max_stages here, since the state may
+    // have changed since the timestep was estimated.
+
+    MultiFab no_mask;
+
+    auto diffuse_dt = timestep::estdt<timestep::diffusion>(geom.data(), no_mask, S_new);
+    ParallelAllReduce::Min(diffuse_dt, MPI_COMM_WORLD);
+
+    const Real dt_expl = cfl * diffuse_dt.value;
+
+    int nstages = static_cast<int>(std::ceil(0.5_rt * (std::sqrt(9.0_rt + 16.0_rt * dt / dt_expl) - 1.0_rt)));
+    nstages = std::max(nstages, 2);
+
+    if (verbose > 0) {
+        amrex::Print() << "... RKL2 thermal diffusion with " << nstages << " stages at level " << level << std::endl;
+    }
+
+    // The Legendre polynomial coefficients, b_0 = b_1 = b_2 = 1/3.
+
+    auto b = [] (int j) -> Real {
+        if (j < 2) {
+            return 1.0_rt / 3.0_rt;
+        }
+        return static_cast<Real>(j * j + j - 2) / static_cast<Real>(2 * j * (j + 1));
+    };
+
+    const Real w1 = 4.0_rt / static_cast<Real>(nstages * nstages + nstages - 2);
+
+    // We evolve rho e, with the same change applied to rho E.  The
+    // current stage always lives in S_new, since that is where
+    // getTempDiffusionTerm gets the temperature from, and we keep the
+    // initial state, its diffusion term, and the previous two stages.
+
+    MultiFab Y0(grids, dmap, 1, 0);
+    MultiFab Y_jm1(grids, dmap, 1, 0);
+    MultiFab Y_jm2(grids, dmap, 1, 0);
+    MultiFab L0(grids, dmap, 1, 0);
+    MultiFab L_jm1(grids, dmap, 1, 0);
+
+    MultiFab::Copy(Y0, S_new, UEINT, 0, 1, 0);
+    MultiFab::Copy(Y_jm1, S_new, UEINT, 0, 1, 0);
+
+    L0.setVal(0.0_rt);
+    getTempDiffusionTerm(time, S_new, L0);
+
+    for (int stage = 1; stage <= nstages; ++stage) {
+
+        Real mu_t;
+        Real mu = 0.0_rt;
+        Real nu = 0.0_rt;
+        Real gamma_t = 0.0_rt;
+
+        if (stage == 1) {
+            mu_t = w1 / 3.0_rt;
+        } else {
+            L_jm1.setVal(0.0_rt);
+            getTempDiffusionTerm(time, S_new, L_jm1);
+
+            mu = static_cast<Real>(2 * stage - 1) / static_cast<Real>(stage) * b(stage) / b(stage-1);
+            nu = -static_cast<Real>(stage - 1) / static_cast<Real>(stage) * b(stage) / b(stage-2);
+            mu_t = mu * w1;
+            gamma_t = -(1.0_rt - b(stage-1)) * mu_t;
+        }
+
+        const Real mu_0 = 1.0_rt - mu - nu;
+        const int first_stage = stage == 1;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+
+            auto u = S_new.array(mfi);
+            auto y0 = Y0.const_array(mfi);
+            auto l0 = L0.const_array(mfi);
+            auto l_jm1 = L_jm1.const_array(mfi);
+            auto y_jm1 = Y_jm1.array(mfi);
+            auto y_jm2 = Y_jm2.array(mfi);
+
+            amrex::ParallelFor(bx,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                Real y_new;
+
+                if (first_stage) {
+                    y_new = y0(i,j,k) + mu_t * dt * l0(i,j,k);
+                } else {
+                    y_new = mu * y_jm1(i,j,k) + nu * y_jm2(i,j,k) + mu_0 * y0(i,j,k) +
+                            mu_t * dt * l_jm1(i,j,k) + gamma_t * dt * l0(i,j,k);
+                }
+
+                u(i,j,k,UEDEN) += y_new - u(i,j,k,UEINT);
+                u(i,j,k,UEINT) = y_new;
+
+                // Shift the stage history: y_jm2 is no longer needed
+                // for this zone once y_new is known.
+
+                y_jm2(i,j,k) = y_jm1(i,j,k);
+                y_jm1(i,j,k) = y_new;
+
+                // The next stage needs the temperature of this one.
+
+                Real rhoInv = 1.0_rt / u(i,j,k,URHO);
+
+                eos_re_t eos_state;
+
+                eos_state.rho = u(i,j,k,URHO);
+                eos_state.T   = u(i,j,k,UTEMP);
+                eos_state.e   = u(i,j,k,UEINT) * rhoInv;
+                for (int n = 0; n < NumSpec; ++n) {
+                    eos_state.xn[n] = u(i,j,k,UFS+n) * rhoInv;
+                }
+#if NAUX_NET > 0
+                for (int n = 0; n < NumAux; ++n) {
+                    eos_state.aux[n] = u(i,j,k,UFX+n) * rhoInv;
+                }
+#endif
+
+                eos(eos_input_re, eos_state);
+
+                u(i,j,k,UTEMP) = eos_state.T;
+            });
+        }
+    }
+
+    if (verbose > 1)
+    {
+        const int IOProc = ParallelDescriptor::IOProcessorNumber();
+        amrex::Real run_time = ParallelDescriptor::second() - strt_time;
+        amrex::Real llevel = level;
+
+#ifdef BL_LAZY
+        Lazy::QueueReduction( [=] () mutable {
+#endif
+        ParallelDescriptor::ReduceRealMax(run_time,IOProc);
+
+        amrex::Print() << "Castro::do_sts_diffusion() time = " << run_time
+                       << " on level " << llevel << "\n" << "\n";
+#ifdef BL_LAZY
+        });
+#endif
+    }
+}
+
 // **********************************************************************************************
 
 void
@@ -15,6 +15,7 @@
 #include <AMReX_Utility.H>
 #include <AMReX_CONSTANTS.H>
 #include <Castro.H>
+#include <Derive.H>
 #include <global.H>
 #include <runtime_parameters.H>
 #include <AMReX_VisMF.H>
@@ -28,6 +29,7 @@
 
 #ifdef AMREX_PARTICLES
 #include <AMReX_Particles.H>
+#include <particles_params.H>
 #endif
 
 #ifdef GRAVITY
@@ -77,6 +79,9 @@ BCRec        Castro::phys_bc;
 int          Castro::lastDtPlotLimited = 0;
 Real         Castro::lastDtBeforePlotLimiting = 0.0;
 
+Long         Castro::num_advance_attempts = 0;
+Long         Castro::num_advance_retries = 0;
+
 params_t     Castro::params;
 
 Real         Castro::num_zones_advanced = 0.0;
@@ -144,6 +149,7 @@ Real         Castro::previousCPUTimeUsed = 0.0;
 Real         Castro::startCPUTime = 0.0;
 
 int          Castro::SDC_Source_Type = -1;
+int          Castro::Work_Estimate_Type = -1;
 int          Castro::num_state_type = 0;
 
 int          Castro::do_cxx_prob_initialize = 0;
@@ -398,6 +404,16 @@ Castro::read_params ()
     }
 #endif
 
+#ifdef DIFFUSION
+    if (diffuse_sts && time_integration_method == SpectralDeferredCorrections) {
+        amrex::Error("castro.diffuse_sts is not supported with true SDC.");
+    }
+
+    if (diffuse_sts && diffuse_sts_max_stages < 2) {
+        amrex::Error("castro.diffuse_sts_max_stages must be at least 2.");
+    }
+#endif
+
 #ifndef AMREX_USE_GPU
 
 #ifdef RADIATION
@@ -479,6 +495,16 @@ Castro::read_params ()
         amrex::Error("castro.use_post_step_regrid == 1 is not consistent with amr.subcycling_mode = None.");
     }
 
+#ifdef REACTIONS
+    if (load_balance_burn_weights == 1 && store_burn_weights == 0) {
+        amrex::Error("castro.load_balance_burn_weights == 1 requires castro.store_burn_weights = 1.");
+    }
+
+    if (dtnuc_use_stored_rates == 1 && dtnuc_X < 1.e199_rt && store_omegadot == 0) {
+        amrex::Error("castro.dtnuc_use_stored_rates == 1 with castro.dtnuc_X requires castro.store_omegadot = 1.");
+    }
+#endif
+
 #ifdef AMREX_PARTICLES
     read_particle_params();
 #endif
@@ -986,6 +1012,8 @@ Castro::initMFs()
 
     lastDt = 1.e200;
 
+    dt_predicted = 1.e200;
+
     if (do_cxx_prob_initialize == 0) {
 
       // sync up some C++ values of the runtime parameters
@@ -1027,6 +1055,10 @@ Castro::initData ()
 
     S_new.setVal(0.);
 
+    if (Work_Estimate_Type >= 0) {
+        get_new_data(Work_Estimate_Type).setVal(load_balance_hydro_cost);
+    }
+
     if (! allow_non_unit_aspect_zones) {
 
         // make sure dx = dy = dz -- that's all we guarantee to support
@@ -1519,6 +1551,8 @@ Castro::init (AmrLevel &old)
 
     keep_prev_state = oldlev->keep_prev_state;
 
+    dt_predicted = oldlev->dt_predicted;
+
     in_retry = oldlev->in_retry;
 
 }
@@ -1607,6 +1641,42 @@ Castro::estTimeStep (int is_new)
 
     std::string limiter = "castro.max_dt";
 
+    // The hydro, diffusion, and burning constraints are evaluated
+    // together in a single pass over the state, followed by a single
+    // parallel reduction.  The MHD and radiation-hydro Courant
+    // conditions have their own estimators.
+
+    bool fused_hydro = do_hydro;
+#ifdef MHD
+    fused_hydro = false;
+#endif
+#ifdef RADIATION
+    if (Radiation::rad_hydro_combined) {
+        fused_hydro = false;
+    }
+#endif
+
+    bool fused_diffusion = false;
+#ifdef DIFFUSION
+    fused_diffusion = diffuse_temp;
+#endif
+
+    bool fused_burning = false;
+    const MultiFab* reactMF = nullptr;
+#ifdef REACTIONS
+    fused_burning = do_react && (castro::dtnuc_e < 1.e199_rt || castro::dtnuc_X < 1.e199_rt);
+    if (fused_burning && dtnuc_use_stored_rates) {
+        reactMF = is_new ? &get_new_data(Reactions_Type) : &get_old_data(Reactions_Type);
+    }
+#endif
+
+    auto fused_dt = timestep::estdt_fused(geomdata, maskMF, stateMF, reactMF,
+                                          fused_hydro, fused_diffusion, fused_burning);
+
+    if (fused_hydro || fused_diffusion || fused_burning) {
+        amrex::ParallelAllReduce::Min(fused_dt.data(), timestep::n_fused, MPI_COMM_WORLD);
+    }
+
     // Start the hydro with the max_dt value, but divide by CFL
     // to account for the fact that we multiply by it at the end.
     // This ensures that if max_dt is more restrictive than the hydro
@@ -1633,11 +1703,11 @@ Castro::estTimeStep (int is_new)
 
 #ifdef MHD
           auto hydro_dt = timestep::estdt<timestep::mhd>(geomdata, maskMF, stateMF, Bx, By, Bz);
+          amrex::ParallelAllReduce::Min(hydro_dt, MPI_COMM_WORLD);
 #else
-          auto hydro_dt = timestep::estdt<timestep::hydro>(geomdata, maskMF, stateMF);
+          const auto& hydro_dt = fused_dt[timestep::fused_hydro];
 #endif
 
-          amrex::ParallelAllReduce::Min(hydro_dt, MPI_COMM_WORLD);
           estdt_hydro = amrex::min(estdt_hydro, hydro_dt.value) * cfl;
           if (verbose) {
               amrex::Print() << "...estimated hydro-limited timestep at level " << level << ": " << estdt_hydro << std::endl;
@@ -1676,10 +1746,18 @@ Castro::estTimeStep (int is_new)
 
     if (diffuse_temp)
     {
-        auto diffuse_dt = timestep::estdt<timestep::diffusion>(geomdata, maskMF, stateMF);
-        ParallelAllReduce::Min(diffuse_dt, MPI_COMM_WORLD);
+        const auto& diffuse_dt = fused_dt[timestep::fused_diffusion];
         estdt_diffusion = amrex::min(estdt_diffusion, diffuse_dt.value) * cfl;
 
+        // With super-time-stepping, the explicit limit only has to
+        // be respected by each of the (at most diffuse_sts_max_stages)
+        // stages of the RKL2 update.
+
+        if (diffuse_sts) {
+            const auto s = static_cast<Real>(diffuse_sts_max_stages);
+            estdt_diffusion *= 0.25_rt * (s * s + s - 2.0_rt);
+        }
+
         if (verbose) {
             amrex::Print() << "...estimated diffusion-limited timestep at level " << level << ": " << estdt_diffusion << std::endl;
             std::string idx_str = "(i";
@@ -1708,13 +1786,12 @@ Castro::estTimeStep (int is_new)
     // Dummy value to start with
     Real estdt_burn = max_dt;
 
-    if (do_react && (castro::dtnuc_e < 1.e199_rt || castro::dtnuc_X < 1.e199_rt)) {
+    if (fused_burning) {
 
-        // Compute burning-limited timestep.
+        // Burning-limited timestep.
 
-        auto burn_dt = timestep::estdt<timestep::burning>(geomdata, maskMF, stateMF);
+        const auto& burn_dt = fused_dt[timestep::fused_burning];
 
-        ParallelAllReduce::Min(burn_dt, MPI_COMM_WORLD);
         estdt_burn = amrex::min(estdt_burn, burn_dt.value);
 
         if (verbose) {
@@ -1773,6 +1850,17 @@ Castro::computeNewDt (int                    finest_level,
     {
         Castro& adv_level = getLevel(i);
         dt_min[i] = adv_level.estTimeStep();
+
+        // Shorten the timestep if the last advance suggests that
+        // this one would otherwise fail and need a retry.
+
+        if (adv_level.dt_predicted < dt_min[i]) {
+            if (verbose) {
+                amrex::Print() << "Castro::compute_new_dt : limiting dt at level " << i
+                               << " to the retry-free prediction " << adv_level.dt_predicted << '\n';
+            }
+            dt_min[i] = adv_level.dt_predicted;
+        }
     }
 
     if (fixed_dt <= 0.0)
@@ -2061,6 +2149,13 @@ Castro::post_timestep (int iteration_local)
 
 #endif
 
+    // The reflux and average-down (and the source term update after
+    // the reflux on the finer levels) may have changed the state data.
+
+    for (int lev = level; lev <= parent->finestLevel(); ++lev) {
+        getLevel(lev).invalidate_derive_cache();
+    }
+
     if (level == 0)
     {
         int nstep = parent->levelSteps(0);
@@ -2120,9 +2215,22 @@ Castro::post_timestep (int iteration_local)
         {
             int ngrow = (level == 0) ? 0 : iteration_local;
 
-            TracerPC->Redistribute(level, parent->finestLevel(), ngrow);
+            // The neighbor ranks used by a local redistribution are
+            // only found from the level 0 grids, so only use it when
+            // that is the only level.
+
+            const int local = (parent->finestLevel() == 0) ? particles::redistribute_local : 0;
+
+            TracerPC->Redistribute(level, parent->finestLevel(), ngrow, local);
 
             TimestampParticles(ngrow+1);
+
+            // Sample all levels once per coarse timestep, so each
+            // particle gets a single record at the synchronized time.
+
+            if (level == 0) {
+                SampleParticles(ngrow+1);
+            }
         }
     }
 #endif
@@ -2133,7 +2241,7 @@ Castro::post_timestep (int iteration_local)
         Real max_field_val = std::numeric_limits<Real>::min();
 
         for (int lev = 0; lev <= parent->finestLevel(); ++lev) {
-            auto mf = getLevel(lev).derive(castro::stopping_criterion_field, state[State_Type].curTime(), 0);
+            auto mf = getLevel(lev).derive_cached(castro::stopping_criterion_field, state[State_Type].curTime(), 0);
             max_field_val = std::max(max_field_val, mf->max(0));
         }
 
@@ -2175,6 +2283,12 @@ Castro::post_restart ()
 {
    BL_PROFILE("Castro::post_restart()");
 
+   // The work estimate is not stored in the checkpoint.
+
+   if (Work_Estimate_Type >= 0) {
+       get_new_data(Work_Estimate_Type).setVal(load_balance_hydro_cost);
+   }
+
 #ifdef AMREX_PARTICLES
    ParticlePostRestart(parent->theRestartFile());
 #endif
@@ -2277,6 +2391,9 @@ Castro::post_regrid (int lbase,
     BL_PROFILE("Castro::post_regrid()");
 
     fine_mask.clear();
+    fine_mask_coverage.clear();
+
+    invalidate_derive_cache();
 
 #ifdef AMREX_PARTICLES
     if (TracerPC && level == lbase) {
@@ -2728,11 +2845,17 @@ Castro::reflux (int crse_level, int fine_level, bool in_post_timestep)
 
         MultiFab& crse_state = crse_lev.get_new_data(State_Type);
 
-        // Get a version of this state with one ghost zone.
+        // Get a version of this state with one ghost zone. The flux limiting
+        // below only looks at the density and the species.
 
         MultiFab expanded_crse_state(crse_state.boxArray(), crse_state.DistributionMap(), crse_state.nComp(), 1);
 
-        crse_lev.expand_state(expanded_crse_state, crse_lev.state[State_Type].curTime(), 1);
+        std::vector<int> reflux_comps{URHO};
+        for (int n = 0; n < NumSpec; ++n) {
+            reflux_comps.push_back(UFS + n);
+        }
+
+        crse_lev.expand_state(expanded_crse_state, crse_lev.state[State_Type].curTime(), 1, reflux_comps);
 
         // Clear out the data that's not on coarse-fine boundaries so that this register only
         // modifies the fluxes on coarse-fine interfaces.
@@ -3041,19 +3164,17 @@ Castro::reflux (int crse_level, int fine_level, bool in_post_timestep)
 
                 for (int k = 0; k < num_state_type; k++) {
 
-                    if (getLevel(lev).prev_state[k]->hasOldData()) {
+                    if (getLevel(lev).prev_state[k] != nullptr) {
 
-                        // Use the new-time data as a temporary buffer. Ideally this would be done
-                        // as a pointer swap, but we cannot assume that the distribution mapping
-                        // is the same between the current state and the original state, due to
-                        // possible regrids that have occurred in between.
+                        // Exchange the data in place, so that no temporary buffer is needed.
+                        // Ideally this would be done as a pointer swap, but we cannot assume
+                        // that the memory arena is the same between the current state and
+                        // the saved state.
 
                         MultiFab& old = getLevel(lev).get_old_data(k);
-                        MultiFab::Copy(getLevel(lev).prev_state[k]->newData(), old, 0, 0, old.nComp(), old.nGrow());
-                        MultiFab::Copy(old, getLevel(lev).prev_state[k]->oldData(), 0, 0, old.nComp(), old.nGrow());
+                        MultiFab::Swap(old, *getLevel(lev).prev_state[k], 0, 0, old.nComp(), old.nGrow());
 
                         getLevel(lev).state[k].setTimeLevel(time, dt_advance_local, 0.0);
-                        getLevel(lev).prev_state[k]->setTimeLevel(time, dt_amr, 0.0);
 
                     }
 
@@ -3074,15 +3195,14 @@ Castro::reflux (int crse_level, int fine_level, bool in_post_timestep)
 
                 for (int k = 0; k < num_state_type; k++) {
 
-                    if (getLevel(lev).prev_state[k]->hasOldData()) {
+                    if (getLevel(lev).prev_state[k] != nullptr) {
 
                         // Now retrieve the original old time data.
 
                         MultiFab& old = getLevel(lev).get_old_data(k);
-                        MultiFab::Copy(old, getLevel(lev).prev_state[k]->newData(), 0, 0, old.nComp(), old.nGrow());
+                        MultiFab::Swap(old, *getLevel(lev).prev_state[k], 0, 0, old.nComp(), old.nGrow());
 
                         getLevel(lev).state[k].setTimeLevel(time, dt_amr, 0.0);
-                        getLevel(lev).prev_state[k]->setTimeLevel(time, dt_advance_local, 0.0);
 
                     }
 
@@ -3134,6 +3254,8 @@ Castro::avgDown ()
       avgDown(k);
   }
 
+  invalidate_derive_cache();
+
 }
 
 void
@@ -3512,9 +3634,9 @@ Castro::errorEst (TagBoxArray& tags,
     // Apply each of the tagging criteria defined in the inputs.
 
     for (const auto & etag : error_tags) {
-        std::unique_ptr<MultiFab> mf;
+        std::shared_ptr<const MultiFab> mf;
         if (! etag.Field().empty()) {
-            mf = derive(etag.Field(), time, etag.NGrow());
+            mf = derive_cached(etag.Field(), time, etag.NGrow());
         }
         etag(tags, mf.get(), TagBox::CLEAR, TagBox::SET, time, level, geom);
     }
@@ -3725,6 +3847,71 @@ Castro::derive (const std::string& name,
     AmrLevel::derive(name,time,mf,dcomp);
 }
 
+std::shared_ptr<const MultiFab>
+Castro::derive_cached (const std::string& name,
+                       Real               time,
+                       int                ngrow)
+{
+    BL_PROFILE("Castro::derive_cached()");
+
+    bool use_cache = cache_derived_fields;
+
+#ifdef AMREX_PARTICLES
+    // The particle counts can change without the state data changing.
+
+    if (name == "particle_count" || name == "total_particle_count") {
+        use_cache = false;
+    }
+#endif
+
+    if (!use_cache) {
+        return derive(name, time, ngrow);
+    }
+
+    const auto key = std::make_pair(name, time);
+
+    auto it = derive_cache.find(key);
+
+    if (it != derive_cache.end() && it->second->nGrow() >= ngrow) {
+        return it->second;
+    }
+
+    std::shared_ptr<const MultiFab> mf = derive(name, time, ngrow);
+
+    derive_cache[key] = mf;
+
+    return mf;
+}
+
+std::unique_ptr<MultiFab>
+Castro::derive_thermo (Real time, int ngrow)
+{
+    BL_PROFILE("Castro::derive_thermo()");
+
+    MultiFab S(grids, dmap, NUM_STATE, ngrow);
+    FillPatch(*this, S, ngrow, time, State_Type, 0, NUM_STATE);
+
+    auto mf = std::make_unique<MultiFab>(grids, dmap, thermo_derive::ncomp, ngrow);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(*mf, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.growntilebox();
+
+        ca_derthermo(bx, (*mf)[mfi], 0, thermo_derive::ncomp, S[mfi], geom, time, nullptr, level);
+    }
+
+    return mf;
+}
+
+void
+Castro::invalidate_derive_cache ()
+{
+    derive_cache.clear();
+}
+
 void
 Castro::extern_init ()
 {
@@ -3998,7 +4185,21 @@ Castro::computeTemp(
     // makes 1 ghost cell a valid center, we compute its temp, and
     // then the final average results only in interior temps valid
     Stemp.define(State.boxArray(), State.DistributionMap(), NUM_STATE, 2);
-    expand_state(Stemp, time, Stemp.nGrow());
+
+    // Only the components that enter the internal energy reset and
+    // the EOS call are needed; zero the rest so that the conversion
+    // to cell centers operates on well-defined data.
+    Stemp.setVal(0.0);
+
+    std::vector<int> eos_comps{URHO, UMX, UMY, UMZ, UEDEN, UEINT, UTEMP};
+    for (int n = 0; n < NumSpec; ++n) {
+        eos_comps.push_back(UFS + n);
+    }
+    for (int n = 0; n < NumAux; ++n) {
+        eos_comps.push_back(UFX + n);
+    }
+
+    expand_state(Stemp, time, Stemp.nGrow(), eos_comps);
 
     // store the Laplacian term for the internal energy
     Eint_lap.define(State.boxArray(), State.DistributionMap(), 1, 0);
@@ -4148,10 +4349,10 @@ Castro::computeTemp(
     MultiFab::Copy(State, Stemp, UTEMP, UTEMP, 1, 0);
     MultiFab::Copy(State, Stemp, UEINT, UEINT, 1, 0);
 
-    // now that we redid these, redo the ghost fill -- technically,
-    // only need this for UTEMP and UEINT, and only if ng > 0
+    // now that we redid these, redo the ghost fill -- we only
+    // need this for UTEMP and UEINT, and only if ng > 0
     if (ng > 0) {
-      AmrLevel::FillPatch(*this, State, State.nGrow(), time, State_Type, 0, NUM_STATE);
+      expand_state(State, time, State.nGrow(), {UEINT, UTEMP});
     }
 
     Stemp.clear();
@@ -4455,11 +4656,43 @@ Castro::build_fine_mask()
                                  parent->boxArray(level), crse_ratio,
                                  1.0,  // coarse
                                  0.0); // fine
+
+        // The coarsened fine boxes are disjoint, so the number of coarse
+        // zones a box has under them tells whether it is covered.
+
+        const BoxArray crse_fine_ba = amrex::coarsen(parent->boxArray(level), crse_ratio);
+
+        fine_mask_coverage.resize(fine_mask.local_size());
+
+        for (MFIter mfi(fine_mask); mfi.isValid(); ++mfi) {
+            const Box& bx = mfi.validbox();
+
+            Long ncovered = 0;
+            for (const auto& isect : crse_fine_ba.intersections(bx)) {
+                ncovered += isect.second.numPts();
+            }
+
+            if (ncovered == 0) {
+                fine_mask_coverage[mfi.LocalIndex()] = fine_coverage::none;
+            } else if (ncovered == bx.numPts()) {
+                fine_mask_coverage[mfi.LocalIndex()] = fine_coverage::full;
+            } else {
+                fine_mask_coverage[mfi.LocalIndex()] = fine_coverage::partial;
+            }
+        }
     }
 
     return fine_mask;
 }
 
+int
+Castro::fine_mask_coverage_of (const MFIter& mfi)
+{
+    BL_ASSERT(level < parent->finestLevel());
+
+    return getLevel(level+1).fine_mask_coverage[mfi.LocalIndex()];
+}
+
 iMultiFab&
 Castro::build_interior_boundary_mask (int ng)
 {
@@ -4499,6 +4732,132 @@ Castro::expand_state(MultiFab& S, Real time, int ng)
 }
 
 
+void
+Castro::expand_state(MultiFab& S, Real time, int ng, const std::vector<int>& comps)
+{
+  BL_PROFILE("Castro::expand_state()");
+
+  BL_ASSERT(S.nGrow() >= ng);
+
+  std::vector<int> sorted_comps(comps);
+  std::sort(sorted_comps.begin(), sorted_comps.end());
+  sorted_comps.erase(std::unique(sorted_comps.begin(), sorted_comps.end()), sorted_comps.end());
+
+  BL_ASSERT(sorted_comps.empty() || sorted_comps.back() < S.nComp());
+
+  // Fill each contiguous run of components with a single FillPatch.
+
+  std::size_t n = 0;
+
+  while (n < sorted_comps.size()) {
+
+      const int scomp = sorted_comps[n];
+      int ncomp = 1;
+
+      while (n + ncomp < sorted_comps.size() && sorted_comps[n + ncomp] == scomp + ncomp) {
+          ++ncomp;
+      }
+
+      AmrLevel::FillPatch(*this, S, ng, time, State_Type, scomp, ncomp, scomp);
+
+      n += ncomp;
+
+  }
+}
+
+
+int
+Castro::hydro_ngrow ()
+{
+#ifdef MHD
+    // The flattening coefficient is needed on every zone where we
+    // reconstruct and has a 3-zone stencil of its own, which is what
+    // sets NUM_GROW. Without it, the PPM stencil on the outermost
+    // reconstructed zones only needs one fewer ghost zone.
+
+    if (!use_flattening) {
+        return NUM_GROW - 1;
+    }
+#endif
+
+    return NUM_GROW;
+}
+
+
+void
+Castro::start_Sborder_fill (Real time)
+{
+    BL_PROFILE("Castro::start_Sborder_fill()");
+
+    if (!async_ghost_fill || level > 0) {
+
+        expand_state(Sborder, time, Sborder.nGrow());
+
+        Sborder_fill_pending = true;
+        finish_Sborder_fill();
+
+        return;
+
+    }
+
+    // On the coarsest level the fill is just a copy of the valid data
+    // followed by a ghost zone exchange and the physical boundary
+    // conditions, so we can post the exchange and return.
+
+    AMREX_ASSERT(time == state[State_Type].prevTime());
+
+    const MultiFab& S_old = get_old_data(State_Type);
+
+    MultiFab::Copy(Sborder, S_old, 0, 0, NUM_STATE, 0);
+
+    Sborder.FillBoundary_nowait(0, NUM_STATE, Sborder.nGrowVect(), geom.periodicity());
+
+    Sborder_fill_pending = true;
+}
+
+
+void
+Castro::finish_Sborder_fill ()
+{
+    if (!Sborder_fill_pending) {
+        return;
+    }
+
+    BL_PROFILE("Castro::finish_Sborder_fill()");
+
+    const Real prev_time = state[State_Type].prevTime();
+
+    if (async_ghost_fill && level == 0) {
+
+        Sborder.FillBoundary_finish();
+
+        StateDataPhysBCFunct physbcf(state[State_Type], 0, geom);
+        physbcf(Sborder, 0, NUM_STATE, Sborder.nGrowVect(), prev_time, 0);
+
+    }
+
+    // Although clean_state has already been done on the old state in
+    // initialize_advance, we still need to do another here to ensure
+    // the ghost zones are thermodynamically consistent.
+
+    clean_state(
+#ifdef MHD
+                Bx_old_tmp, By_old_tmp, Bz_old_tmp,
+#endif
+                Sborder, prev_time, Sborder.nGrow());
+
+#ifdef SHOCK_VAR
+    // Zero out the shock data, and fill it during the advance.
+    // For subcycling cases this will always give the shock
+    // variable for the latest subcycle, rather than averaging.
+
+    Sborder.setVal(0.0, USHK, 1, Sborder.nGrow());
+#endif
+
+    Sborder_fill_pending = false;
+}
+
+
 void
 Castro::check_for_nan(const MultiFab& state_in, int check_ghost)
 {
@@ -4574,28 +4933,33 @@ Castro::save_data_for_retry ()
 {
     BL_PROFILE("Castro::save_data_for_retry()");
 
+    // Only the old-time data needs to be saved: the advance is redone
+    // from it, and at the end of the subcycles it is swapped back in so
+    // that it appears that a single timestep was taken. The new-time data
+    // is entirely overwritten by the advance, so we don't keep a copy of
+    // it. The work estimate is recomputed at the end of the advance, so
+    // it is not saved either.
+
     for (int k = 0; k < num_state_type; k++) {
 
+        if (prev_state[k] != nullptr || !state[k].hasOldData() || k == Work_Estimate_Type) {
+            continue;
+        }
+
+        const MultiFab& old = state[k].oldData();
+
         // We want to store the previous state in pinned memory
         // if we're running on a GPU. This helps us alleviate
         // pressure on the GPU memory, at the slight cost of
         // lower bandwidth when we are saving/restoring the state.
-        // Since we're using operator= to copy the StateData,
-        // we'll use a trick where we temporarily change the
-        // the arena used by the main state and then immediately
-        // restore it.
-
-        if (!prev_state[k]->hasOldData()) {
 
+        MFInfo info;
 #ifdef AMREX_USE_GPU
-            Arena* old_arena = state[k].getArena();
-            state[k].setArena(The_Pinned_Arena());
-#endif
-            *prev_state[k] = state[k];
-#ifdef AMREX_USE_GPU
-            state[k].setArena(old_arena);
+        info.SetArena(The_Pinned_Arena());
 #endif
-        }
+
+        prev_state[k] = std::make_unique<MultiFab>(old.boxArray(), old.DistributionMap(), old.nComp(), old.nGrow(), info);
+        MultiFab::Copy(*prev_state[k], old, 0, 0, old.nComp(), old.nGrow());
 
     }
 
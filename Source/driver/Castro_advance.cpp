@@ -106,6 +106,10 @@ Castro::advance (Real time,
         getLevel(lev).advance_particles(amr_iteration, time, dt);
 #endif
 
+        if (time_integration_method == CornerTransportUpwind || time_integration_method == SimplifiedSpectralDeferredCorrections) {
+            getLevel(lev).predict_next_dt(dt);
+        }
+
         getLevel(lev).finalize_advance();
     }
 
@@ -140,56 +144,51 @@ Castro::initialize_do_advance (Real time, Real dt)
     }
 #endif
 
-    // For the hydrodynamics update we need to have NUM_GROW ghost
+    // For the hydrodynamics update we need to have hydro_ngrow() ghost
     // zones available, but the state data does not carry ghost
     // zones. So we use a FillPatch using the state data to give us
     // Sborder, which does have ghost zones.
 
     if (time_integration_method == CornerTransportUpwind || time_integration_method == SimplifiedSpectralDeferredCorrections) {
+      const int ng_hydro = hydro_ngrow();
+
 #ifdef MHD
       MultiFab& Bx_old = get_old_data(Mag_Type_x);
       MultiFab& By_old = get_old_data(Mag_Type_y);
       MultiFab& Bz_old = get_old_data(Mag_Type_z);
 
-      Bx_old_tmp.define(Bx_old.boxArray(), Bx_old.DistributionMap(), 1, NUM_GROW);
-      By_old_tmp.define(By_old.boxArray(), By_old.DistributionMap(), 1, NUM_GROW);
-      Bz_old_tmp.define(Bz_old.boxArray(), Bz_old.DistributionMap(), 1, NUM_GROW);
+      Bx_old_tmp.define(Bx_old.boxArray(), Bx_old.DistributionMap(), 1, ng_hydro);
+      By_old_tmp.define(By_old.boxArray(), By_old.DistributionMap(), 1, ng_hydro);
+      Bz_old_tmp.define(Bz_old.boxArray(), Bz_old.DistributionMap(), 1, ng_hydro);
 
-      FillPatch(*this, Bx_old_tmp, NUM_GROW, time, Mag_Type_x, 0, 1);
-      FillPatch(*this, By_old_tmp, NUM_GROW, time, Mag_Type_y, 0, 1);
-      FillPatch(*this, Bz_old_tmp, NUM_GROW, time, Mag_Type_z, 0, 1);
+      FillPatch(*this, Bx_old_tmp, ng_hydro, time, Mag_Type_x, 0, 1);
+      FillPatch(*this, By_old_tmp, ng_hydro, time, Mag_Type_y, 0, 1);
+      FillPatch(*this, Bz_old_tmp, ng_hydro, time, Mag_Type_z, 0, 1);
 #endif
       // for the CTU unsplit method, we always start with the old
-      // state note: although clean_state has already been done on
-      // the old state in initialize_advance, we still need to do
-      // another here to ensure the ghost zones are thermodynamically
-      // consistent
-      Sborder.define(grids, dmap, NUM_STATE, NUM_GROW, MFInfo().SetTag("Sborder"));
+      // state. If the ghost zone exchange is asynchronous, it is
+      // completed (and the ghost zones cleaned) in pre_advance_operators,
+      // and the work below, which only needs the old state data, is
+      // overlapped with it.
+      Sborder.define(grids, dmap, NUM_STATE, ng_hydro, MFInfo().SetTag("Sborder"));
       const Real prev_time = state[State_Type].prevTime();
-      expand_state(Sborder, prev_time, NUM_GROW);
-      clean_state(
-#ifdef MHD
-                  Bx_old_tmp, By_old_tmp, Bz_old_tmp,
-#endif
-                  Sborder, prev_time, NUM_GROW);
+      start_Sborder_fill(prev_time);
 
     } else if (time_integration_method == SpectralDeferredCorrections) {
 
       // we'll handle the filling inside of do_advance_sdc
       Sborder.define(grids, dmap, NUM_STATE, NUM_GROW, MFInfo().SetTag("Sborder"));
 
-    } else {
-      amrex::Abort("invalid time_integration_method");
-    }
-
 #ifdef SHOCK_VAR
-    // Zero out the shock data, and fill it during the advance.
-    // For subcycling cases this will always give the shock
-    // variable for the latest subcycle, rather than averaging.
+      // Zero out the shock data, and fill it during the advance.
 
-    Sborder.setVal(0.0, USHK, 1, Sborder.nGrow());
+      Sborder.setVal(0.0, USHK, 1, Sborder.nGrow());
 #endif
 
+    } else {
+      amrex::Abort("invalid time_integration_method");
+    }
+
     // Create any correctors to the source term data. This must be done
     // before the source term data is overwritten below. Note: we do
     // not create the corrector source if we're currently retrying the
@@ -248,6 +247,12 @@ Castro::initialize_do_advance (Real time, Real dt)
         }
     }
 
+    // Don't leave the ghost zone exchange in flight if we are bailing out.
+
+    if (!status.success) {
+        finish_Sborder_fill();
+    }
+
     return status;
 }
 
@@ -329,6 +334,10 @@ Castro::initialize_advance(Real time, Real dt, int amr_iteration)
 {
     BL_PROFILE("Castro::initialize_advance()");
 
+    // The advance will change the state data.
+
+    invalidate_derive_cache();
+
     // Save the current iteration.
 
     iteration = amr_iteration;
@@ -493,12 +502,10 @@ Castro::initialize_advance(Real time, Real dt, int amr_iteration)
                   S_old, time, S_old.nGrow());
 
 
-    // Initialize the previous state data container now, so that we can
-    // always ask if it has valid data.
+    // Clear the retry data now, so that we can always ask if it
+    // has valid data.
 
-    for (int k = 0; k < num_state_type; ++k) {
-        prev_state[k] = std::make_unique<StateData>();
-    }
+    amrex::FillNull(prev_state);
 
 
     // Allocate space for the primitive variables.
@@ -533,6 +540,10 @@ Castro::initialize_advance(Real time, Real dt, int amr_iteration)
         A_old[n]->setVal(0.0);
       }
 
+      // A_new[0] never changes over the iterations, so it shares
+      // storage with A_old[0].  The last node needs its own storage,
+      // since A_new there is the starting guess for the reaction
+      // solve in the first iteration (where it is zero).
       A_new.resize(SDC_NODES);
       A_new[0] = std::make_unique<MultiFab>(*A_old[0], amrex::make_alias, 0, NUM_STATE);
       for (int n = 1; n < SDC_NODES; ++n) {
@@ -550,11 +561,21 @@ Castro::initialize_advance(Real time, Real dt, int amr_iteration)
       Sburn.define(grids, dmap, NUM_STATE, 2);
 
 #ifdef REACTIONS
+      // The Radau quadrature does not include the first node, so the
+      // reaction source there is only used to start the first
+      // iteration, where it is the same on all nodes.  In that case it
+      // can share storage with node 1.
       R_old.resize(SDC_NODES);
       for (int n = 0; n < SDC_NODES; ++n) {
+        if (n == 0 && sdc_quadrature == 1) {
+          continue;
+        }
         R_old[n] = std::make_unique<MultiFab>(grids, dmap, NUM_STATE, 0);
         R_old[n]->setVal(0.0);
       }
+      if (sdc_quadrature == 1) {
+        R_old[0] = std::make_unique<MultiFab>(*R_old[1], amrex::make_alias, 0, NUM_STATE);
+      }
 #endif
 
     }
@@ -596,6 +617,12 @@ Castro::finalize_advance()
 {
     BL_PROFILE("Castro::finalize_advance()");
 
+    invalidate_derive_cache();
+
+    if (Work_Estimate_Type >= 0) {
+        update_work_estimate();
+    }
+
     if (do_reflux == 1 && parent->subcyclingMode() != "None") {
         FluxRegCrseInit();
         FluxRegFineAdd();
@@ -237,11 +237,124 @@ Castro::retry_advance_ctu(Real dt, const advance_status& status)
 
     }
 
+    if (do_retry) {
+        num_advance_retries += 1;
+    }
+
     return do_retry;
 }
 
 
 
+void
+Castro::predict_next_dt (Real dt)
+{
+    dt_predicted = 1.e200;
+
+    if (!retry_predict) {
+        return;
+    }
+
+    BL_PROFILE("Castro::predict_next_dt()");
+
+    const MultiFab& S_old = get_old_data(State_Type);
+    const MultiFab& S_new = get_new_data(State_Type);
+
+#ifdef REACTIONS
+    const int nweights = (store_burn_weights && burn_weights.ok()) ? burn_weights.nComp() : 0;
+#endif
+
+    ReduceOps<ReduceOpMax, ReduceOpMax> reduce_op;
+    ReduceData<Real, Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto uold = S_old.const_array(mfi);
+        auto unew = S_new.const_array(mfi);
+
+#ifdef REACTIONS
+        auto weights = nweights > 0 ? burn_weights.const_array(mfi) : Array4<Real const>{};
+#endif
+
+        reduce_op.eval(bx, reduce_data,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
+        {
+            // The largest relative change in the density and internal energy.
+
+            Real rho_old = amrex::max(uold(i,j,k,URHO), small_dens);
+            Real change = std::abs(unew(i,j,k,URHO) - uold(i,j,k,URHO)) / rho_old;
+
+            Real rhoe_old = std::abs(uold(i,j,k,UEINT));
+            if (rhoe_old > 0.0_rt) {
+                change = amrex::max(change, std::abs(unew(i,j,k,UEINT) - uold(i,j,k,UEINT)) / rhoe_old);
+            }
+
+            // The number of RHS evaluations (plus twice the number of
+            // Jacobian evaluations) the burner needed in this zone.
+
+            Real work = 0.0_rt;
+
+#ifdef REACTIONS
+            for (int n = 0; n < nweights; ++n) {
+                work += weights(i,j,k,n);
+            }
+#endif
+
+            return {change, work};
+        });
+    }
+
+    ReduceTuple hv = reduce_data.value();
+    Real max_change = amrex::get<0>(hv);
+    Real max_work = amrex::get<1>(hv);
+
+    ParallelDescriptor::ReduceRealMax(max_change);
+    ParallelDescriptor::ReduceRealMax(max_work);
+
+    // Scale the timestep so that the next advance would see changes
+    // at the targeted level, assuming they are proportional to dt.
+
+    Real dt_pred = 1.e200;
+
+    if (retry_predict_max_change > 0.0_rt && max_change > retry_predict_max_change) {
+        dt_pred = amrex::min(dt_pred, dt * retry_predict_max_change / max_change);
+    }
+
+    if (retry_predict_max_burn_work > 0.0_rt && max_work > retry_predict_max_burn_work) {
+        dt_pred = amrex::min(dt_pred, dt * retry_predict_max_burn_work / max_work);
+    }
+
+    // If we needed a retry on this advance, don't start the next one
+    // with a timestep larger than the subcycles we ended up taking.
+
+    if (num_subcycles_taken > 1) {
+        dt_pred = amrex::min(dt_pred, dt / static_cast<Real>(num_subcycles_taken));
+    }
+
+    // Never shrink the timestep by more than a retry would.
+
+    if (dt_pred < 1.e200) {
+        dt_predicted = amrex::max(dt_pred, retry_subcycle_factor * dt);
+    }
+
+    if (verbose) {
+        amrex::Print() << "... retry prediction at level " << level << ": max relative change = " << max_change
+                       << ", max burn work = " << max_work;
+        if (dt_predicted < 1.e200) {
+            amrex::Print() << ", predicted dt = " << dt_predicted;
+        }
+        amrex::Print() << std::endl;
+    }
+}
+
+
+
 Real
 Castro::subcycle_advance_ctu(const Real time, const Real dt, int amr_iteration, int amr_ncycle)
 {
@@ -425,6 +538,8 @@ Castro::subcycle_advance_ctu(const Real time, const Real dt, int amr_iteration,
 
         }
 
+        num_advance_attempts += 1;
+
         if (verbose && ParallelDescriptor::IOProcessor()) {
             std::cout << Font::Bold << FGColor::Green << "  Subcycle completed" << ResetDisplay << std::endl << std::endl;
         }
@@ -488,11 +603,17 @@ Castro::subcycle_advance_ctu(const Real time, const Real dt, int amr_iteration,
 
         for (int lev = level; lev <= max_level_to_advance; ++lev) {
             for (int k = 0; k < num_state_type; k++) {
-                if (getLevel(lev).prev_state[k]->hasOldData()) {
-                    getLevel(lev).state[k].replaceOldData(*getLevel(lev).prev_state[k]);
+                if (getLevel(lev).prev_state[k] != nullptr) {
+                    MultiFab& old = getLevel(lev).get_old_data(k);
+#ifdef AMREX_USE_GPU
+                    // The saved data lives in pinned memory, so copy it
+                    // back rather than leaving the state on the host.
+                    MultiFab::Swap(old, *getLevel(lev).prev_state[k], 0, 0, old.nComp(), old.nGrow());
+#else
+                    std::swap(old, *getLevel(lev).prev_state[k]);
+#endif
                 }
                 getLevel(lev).state[k].setTimeLevel(time + dt, dt, 0.0);
-                getLevel(lev).prev_state[k]->setTimeLevel(time + dt, dt_subcycle, 0.0);
             }
         }
 
@@ -189,8 +189,10 @@ Castro::do_advance_sdc (Real time,
       construct_old_react_source(Sborder, *(R_old[0]), input_is_average);
 
       // copy to the other nodes -- since the state is the same on all
-      // nodes for sdc_iteration == 0
-      for (int n = 1; n < SDC_NODES; n++) {
+      // nodes for sdc_iteration == 0.  For Radau, R_old[0] and
+      // R_old[1] share storage.
+      const int n_start = (sdc_quadrature == 1) ? 2 : 1;
+      for (int n = n_start; n < SDC_NODES; n++) {
         MultiFab::Copy(*(R_old[n]), *(R_old[0]), 0, 0, R_old[0]->nComp(), 0);
       }
 #endif
@@ -222,9 +224,11 @@ Castro::do_advance_sdc (Real time,
 
   if (sdc_iteration != sdc_order+sdc_extra-1) {
     // store A_old for the next SDC iteration -- don't need to do n=0,
-    // since that is unchanged
+    // since that is unchanged.  We can just swap the buffers, since
+    // A_new is recomputed at each node before it is used (the lagged
+    // A_new[m_end] is only read in the first iteration).
     for (int n=1; n < SDC_NODES; n++) {
-      MultiFab::Copy(*(A_old[n]), *(A_new[n]), 0, 0, NUM_STATE, 0);
+      std::swap(A_old[n], A_new[n]);
     }
   }
 
@@ -11,6 +11,7 @@
 #include <AMReX_Utility.H>
 #include <Castro.H>
 #include <Castro_io.H>
+#include <Derive.H>
 #include <AMReX_ParmParse.H>
 
 #ifdef RADIATION
@@ -1170,13 +1171,40 @@ Castro::plotFileOutput(const std::string& dir,
     //
     if (!dlist.empty())
     {
+        auto is_plotted = [&] (const DeriveRec& dd)
+        {
+            return (parent->isDerivePlotVar(dd.name()) && is_small == 0) ||
+                   (parent->isDeriveSmallPlotVar(dd.name()) && is_small == 1);
+        };
+
+        // Each of the thermodynamic quantities needs an EOS call, so if
+        // several are plotted, derive them together with one call per zone.
+
+        int n_thermo = 0;
+        for (const auto & dd : dlist) {
+            if (is_plotted(dd) && thermo_derive::component(dd.name()) >= 0) {
+                n_thermo++;
+            }
+        }
+
+        std::unique_ptr<MultiFab> thermo_dat;
+        if (n_thermo > 1) {
+            thermo_dat = derive_thermo(cur_time, nGrow);
+        }
+
         for (const auto & dd : dlist) {
 
-            if ((parent->isDerivePlotVar(dd.name()) && is_small == 0) ||
-                (parent->isDeriveSmallPlotVar(dd.name()) && is_small == 1)) {
+            if (is_plotted(dd)) {
 
-                auto derive_dat = derive(dd.variableName(0), cur_time, nGrow);
-                MultiFab::Copy(plotMF, *derive_dat, 0, cnt, dd.numDerive(), nGrow);
+                const int thermo_comp = thermo_derive::component(dd.name());
+
+                if (thermo_dat != nullptr && thermo_comp >= 0) {
+                    MultiFab::Copy(plotMF, *thermo_dat, thermo_comp, cnt, 1, nGrow);
+                }
+                else {
+                    auto derive_dat = derive_cached(dd.variableName(0), cur_time, nGrow);
+                    MultiFab::Copy(plotMF, *derive_dat, 0, cnt, dd.numDerive(), nGrow);
+                }
                 cnt = cnt + dd.numDerive();
             }
         }
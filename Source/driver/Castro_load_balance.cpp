@@ -0,0 +1,163 @@
+#include <Castro.H>
+
+#include <AMReX_Amr.H>
+
+using namespace amrex;
+
+namespace {
+
+    // The total work estimate in each box of a level, summed over all ranks.
+
+    Vector<Real> box_work (const MultiFab& work)
+    {
+        Vector<Real> w(work.size(), 0.0_rt);
+
+        for (MFIter mfi(work); mfi.isValid(); ++mfi) {
+            w[mfi.index()] = work[mfi].sum<RunOn::Device>(mfi.validbox(), 0);
+        }
+
+        ParallelDescriptor::ReduceRealSum(w.dataPtr(), static_cast<int>(w.size()));
+
+        return w;
+    }
+
+    // The ratio of the maximum to the average work per rank if the boxes
+    // are distributed according to dm.
+
+    Real load_imbalance (const Vector<Real>& w, const DistributionMapping& dm)
+    {
+        const int nprocs = ParallelDescriptor::NProcs();
+
+        Vector<Real> rank_work(nprocs, 0.0_rt);
+
+        for (int i = 0; i < static_cast<int>(w.size()); ++i) {
+            rank_work[dm[i]] += w[i];
+        }
+
+        Real total = 0.0_rt;
+        Real max_work = 0.0_rt;
+
+        for (int n = 0; n < nprocs; ++n) {
+            total += rank_work[n];
+            max_work = std::max(max_work, rank_work[n]);
+        }
+
+        if (total <= 0.0_rt) {
+            return 1.0_rt;
+        }
+
+        return max_work * static_cast<Real>(nprocs) / total;
+    }
+
+}
+
+void
+Castro::update_work_estimate ()
+{
+    BL_PROFILE("Castro::update_work_estimate()");
+
+    MultiFab& work = get_new_data(Work_Estimate_Type);
+
+    const Real hydro_cost = load_balance_hydro_cost;
+
+#ifdef REACTIONS
+    // The burn weights are the number of RHS evaluations plus twice the
+    // number of Jacobian evaluations in each zone for each burn in the
+    // last advance.
+
+    const int nweights = burn_weights.ok() ? burn_weights.nComp() : 0;
+#endif
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(work, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto w = work.array(mfi);
+
+#ifdef REACTIONS
+        auto weights = nweights > 0 ? burn_weights.array(mfi) : Array4<Real>{};
+#endif
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            Real cost = hydro_cost;
+
+#ifdef REACTIONS
+            for (int n = 0; n < nweights; ++n) {
+                cost += weights(i,j,k,n);
+            }
+#endif
+
+            w(i,j,k) = cost;
+        });
+    }
+}
+
+void
+Castro::rebalance (Amr& amr)
+{
+    if (Work_Estimate_Type < 0 || load_balance_threshold <= 0.0_rt) {
+        return;
+    }
+
+    if (ParallelDescriptor::NProcs() == 1) {
+        return;
+    }
+
+    BL_PROFILE("Castro::rebalance()");
+
+    bool redistributed = false;
+
+    for (int lev = 0; lev <= amr.finestLevel(); ++lev) {
+
+        const MultiFab& work = amr.getLevel(lev).get_new_data(Work_Estimate_Type);
+
+        const Vector<Real> w = box_work(work);
+
+        const Real old_imbalance = load_imbalance(w, work.DistributionMap());
+
+        if (old_imbalance <= load_balance_threshold) {
+            continue;
+        }
+
+        DistributionMapping new_dm = DistributionMapping::makeKnapSack(work);
+
+        const Real new_imbalance = load_imbalance(w, new_dm);
+
+        if (verbose > 0) {
+            amrex::Print() << "... load imbalance at level " << lev << " is " << old_imbalance
+                           << ", redistributing would give " << new_imbalance << std::endl;
+        }
+
+        // Replacing the distribution map rebuilds the level (and
+        // invalidates work), so only do it if it helps.
+
+        if (new_imbalance < old_imbalance) {
+            amr.InstallNewDistributionMap(lev, new_dm);
+            redistributed = true;
+
+            // The next finer level is not rebuilt, but its fine mask
+            // lives on this level's grids, so it has to be rebuilt with
+            // the new distribution map the next time it is needed.
+
+            if (lev < amr.finestLevel()) {
+                auto& fine_level = dynamic_cast<Castro&>(amr.getLevel(lev+1));
+                fine_level.fine_mask.clear();
+                fine_level.fine_mask_coverage.clear();
+            }
+        }
+
+    }
+
+#ifdef AMREX_PARTICLES
+    if (redistributed && TracerPC != nullptr) {
+        TracerPC->Redistribute();
+    }
+#else
+    amrex::ignore_unused(redistributed);
+#endif
+}
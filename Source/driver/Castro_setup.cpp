@@ -723,6 +723,21 @@ Castro::variableSetUp ()
   }
 #endif
 
+  if (load_balance_burn_weights) {
+
+    // the work estimate used for load balancing.  This only needs
+    // to be valid zones, and is simply reset after a restart.
+    Work_Estimate_Type = desc_lst.size();
+
+    store_in_checkpoint = false;
+    desc_lst.addDescriptor(Work_Estimate_Type, IndexType::TheCellType(),
+                           StateDescriptor::Point, 0, 1,
+                           &mf_pc_interp, state_data_extrap, store_in_checkpoint);
+
+    set_scalar_bc(bc, phys_bc);
+    desc_lst.setComponent(Work_Estimate_Type, 0, "work_estimate", bc, genericBndryFunc);
+  }
+
   num_state_type = desc_lst.size();
 
   //
@@ -316,6 +316,50 @@ extern "C"
       });
     }
 
+    void ca_derthermo(const Box& bx, FArrayBox& derfab, int dcomp, int /*ncomp*/,
+                      const FArrayBox& datfab, const Geometry& /*geom*/,
+                      Real /*time*/, const int* /*bcrec*/, int /*level*/)
+    {
+
+      auto const dat = datfab.array();
+      auto const der = derfab.array(dcomp);
+
+      amrex::ParallelFor(bx,
+      [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+      {
+
+        Real rhoInv = 1.0_rt / dat(i,j,k,URHO);
+
+        eos_t eos_state;
+        eos_state.rho  = dat(i,j,k,URHO);
+        eos_state.T = dat(i,j,k,UTEMP);
+        eos_state.e = dat(i,j,k,UEINT) * rhoInv;
+        for (int n = 0; n < NumSpec; n++) {
+          eos_state.xn[n] = dat(i,j,k,UFS+n) * rhoInv;
+        }
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; n++) {
+          eos_state.aux[n] = dat(i,j,k,UFX+n) * rhoInv;
+        }
+#endif
+
+        eos(eos_input_re, eos_state);
+
+        Real u = dat(i,j,k,UMX) / dat(i,j,k,URHO);
+
+        der(i,j,k,thermo_derive::pressure) = eos_state.p;
+        der(i,j,k,thermo_derive::soundspeed) = eos_state.cs;
+        der(i,j,k,thermo_derive::Gamma_1) = eos_state.gam1;
+        der(i,j,k,thermo_derive::MachNumber) = std::sqrt(dat(i,j,k,UMX)*dat(i,j,k,UMX) +
+                                                         dat(i,j,k,UMY)*dat(i,j,k,UMY) +
+                                                         dat(i,j,k,UMZ)*dat(i,j,k,UMZ)) /
+          dat(i,j,k,URHO) / eos_state.cs;
+        der(i,j,k,thermo_derive::entropy) = eos_state.s;
+        der(i,j,k,thermo_derive::uplusc) = u + eos_state.cs;
+        der(i,j,k,thermo_derive::uminusc) = u - eos_state.cs;
+      });
+    }
+
 #ifdef DIFFUSION
     void ca_dercond(const Box& bx, FArrayBox& derfab, int /*dcomp*/, int /*ncomp*/,
                     const FArrayBox& datfab, const Geometry& /*geom*/,
@@ -1254,3 +1298,29 @@ extern "C"
 #ifdef __cplusplus
 }
 #endif
+
+int thermo_derive::component (const std::string& name)
+{
+    if (name == "pressure") {
+        return pressure;
+    }
+    if (name == "soundspeed") {
+        return soundspeed;
+    }
+    if (name == "Gamma_1") {
+        return Gamma_1;
+    }
+    if (name == "MachNumber") {
+        return MachNumber;
+    }
+    if (name == "entropy") {
+        return entropy;
+    }
+    if (name == "uplusc") {
+        return uplusc;
+    }
+    if (name == "uminusc") {
+        return uminusc;
+    }
+    return -1;
+}
@@ -171,6 +171,11 @@ main (int   argc,
         // Do a timestep.
         //
         amrptr->coarseTimeStep(stop_time);
+
+        //
+        // Redistribute the grids if the load is too imbalanced.
+        //
+        Castro::rebalance(*amrptr);
     }
 
 #ifdef DO_PROBLEM_POST_SIMULATION
@@ -19,8 +19,6 @@ Castro::sum_integrated_quantities ()
 
     BL_PROFILE("Castro::sum_integrated_quantities()");
 
-    bool local_flag = true;
-
     int finest_level = parent->finestLevel();
     Real time        = state[State_Type].curTime();
     Real dt          = parent->dtLevel(0);
@@ -54,206 +52,51 @@ Castro::sum_integrated_quantities ()
     int fixwidth     = 25; // Floating point data not in scientific notation
     int intwidth     = 12; // Integer data
 
-    for (int lev = 0; lev <= finest_level; lev++)
-    {
-        Castro& ca_lev = getLevel(lev);
-        const MultiFab& S_new = ca_lev.get_new_data(State_Type);
-#ifdef GRAVITY
-        MultiFab& phi_new = ca_lev.get_new_data(PhiGrav_Type);
-#endif
-#ifdef REACTIONS
-        MultiFab& R_new = ca_lev.get_new_data(Reactions_Type);
-#endif
-
-        mass   += ca_lev.volWgtSum(S_new, URHO, local_flag);
-        mom[0] += ca_lev.volWgtSum(S_new, UMX, local_flag);
-        mom[1] += ca_lev.volWgtSum(S_new, UMY, local_flag);
-        mom[2] += ca_lev.volWgtSum(S_new, UMZ, local_flag);
-
-        ang_mom[0] += ca_lev.volWgtSum("angular_momentum_x", time, local_flag);
-        ang_mom[1] += ca_lev.volWgtSum("angular_momentum_y", time, local_flag);
-        ang_mom[2] += ca_lev.volWgtSum("angular_momentum_z", time, local_flag);
-
-#ifdef HYBRID_MOMENTUM
-        hyb_mom[0] += ca_lev.volWgtSum(S_new, UMR, local_flag);
-        hyb_mom[1] += ca_lev.volWgtSum(S_new, UML, local_flag);
-        hyb_mom[2] += ca_lev.volWgtSum(S_new, UMP, local_flag);
-#endif
-
-        com[0] += ca_lev.locWgtSum(S_new, URHO, 0, local_flag);
-        com[1] += ca_lev.locWgtSum(S_new, URHO, 1, local_flag);
-        com[2] += ca_lev.locWgtSum(S_new, URHO, 2, local_flag);
-
-        rho_e += ca_lev.volWgtSum(S_new, UEINT, local_flag);
-        rho_K += ca_lev.volWgtSum("kineng", time, local_flag);
-        rho_E += ca_lev.volWgtSum(S_new, UEDEN, local_flag);
-#ifdef GRAVITY
-        if (gravity->get_gravity_type() == "PoissonGrav") {
-            rho_phi += ca_lev.volProductSum(S_new, phi_new, URHO, 0, local_flag);
-        }
-#endif
-
-        // Compute extrema
-
-#ifdef REACTIONS
-        auto dx = ca_lev.geom.CellSizeArray();
-
-        Real dd = 0.0_rt;
-#if AMREX_SPACEDIM == 1
-        dd = dx[0];
-#elif AMREX_SPACEDIM == 2
-        dd = amrex::min(dx[0], dx[1]);
-#else
-        dd = amrex::min(dx[0], dx[1], dx[2]);
-#endif
-#endif
-
-        bool mask_available = true;
-        if (lev == parent->finestLevel()) {
-            mask_available = false;
-        }
-
-        MultiFab tmp_mf;
-        const MultiFab& mask_mf = mask_available ? getLevel(lev+1).build_fine_mask() : tmp_mf;
-
-        ReduceOps<ReduceOpMax, ReduceOpMax, ReduceOpMax> reduce_op;
-        ReduceData<Real, Real, Real> reduce_data(reduce_op);
-        using ReduceTuple = typename decltype(reduce_data)::Type;
-
-#ifdef AMREX_USE_OMP
-#pragma omp parallel
-#endif
-        for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-            const Box& bx = mfi.tilebox();
-
-            auto U = S_new[mfi].array();
-#ifdef REACTIONS
-            auto R = R_new[mfi].array();
-#endif
-
-            const auto & level_mask = mask_available ? mask_mf[mfi].array() : Array4<Real>{};
-
-            reduce_op.eval(bx, reduce_data,
-            [=] AMREX_GPU_DEVICE (int i, int j, int k) -> ReduceTuple
-            {
-                Real maskFactor = 1.0;
-                if (mask_available) {
-                    maskFactor = level_mask(i,j,k);
-                }
-
-                Real T = U(i,j,k,UTEMP) * maskFactor;
-                Real rho = U(i,j,k,URHO) * maskFactor;
-                Real ts_te = 0.0_rt;
-
-#ifdef REACTIONS
-                Real enuc = std::abs(R(i,j,k,0)) / U(i,j,k,URHO);
-
-                if (enuc > 1.e-100_rt && maskFactor == 1.0) {
-
-                    Real rhoInv = 1.0_rt / rho;
-
-                    // Calculate sound speed
-                    eos_rep_t eos_state;
-                    eos_state.rho = rho;
-                    eos_state.T   = T;
-                    eos_state.e   = U(i,j,k,UEINT) * rhoInv;
-                    for (int n = 0; n < NumSpec; ++n) {
-                        eos_state.xn[n] = U(i,j,k,UFS+n) * rhoInv;
-                    }
-#if NAUX_NET > 0
-                    for (int n = 0; n < NumAux; ++n) {
-                        eos_state.aux[n] = U(i,j,k,UFX+n) * rhoInv;
-                    }
-#endif
-
-                    eos(eos_input_re, eos_state);
-
-                    Real t_e = eos_state.e / enuc;
-                    Real t_s = dd / eos_state.cs;
-
-                    ts_te = t_s / t_e;
-                }
-#endif
-
-                return {T, rho, ts_te};
-            });
+    // All of the integrated quantities, including the species
+    // masses, are computed in a single pass over each level and
+    // then reduced together.
 
-        }
+    Vector<Real> sums(int_sum::nsum, 0.0_rt);
+    Vector<Real> maxes(int_sum::nmax, 0.0_rt);
 
-        ReduceTuple hv = reduce_data.value();
+    for (int lev = 0; lev <= finest_level; lev++)
+    {
+        getLevel(lev).integrated_quantities_sweep(sums, maxes);
+    }
 
-        T_max = amrex::max(T_max, amrex::get<0>(hv));
-        rho_max = amrex::max(rho_max, amrex::get<1>(hv));
-#ifdef REACTIONS
-        ts_te_max = amrex::max(ts_te_max, amrex::get<2>(hv));
-#endif
+    ParallelDescriptor::ReduceRealSum(sums.dataPtr(), int_sum::nsum, ParallelDescriptor::IOProcessorNumber());
 
-    }
+    ParallelDescriptor::ReduceRealMax(maxes.dataPtr(), int_sum::nmax, ParallelDescriptor::IOProcessorNumber());
 
     if (verbose > 0)
     {
 
-#ifdef HYBRID_MOMENTUM
-#ifdef GRAVITY
-       const int nfoo = 17;
-#else
-       const int nfoo = 16;
-#endif
-#else
-#ifdef GRAVITY
-       const int nfoo = 14;
-#else
-       const int nfoo = 13;
-#endif
-#endif
-
-        Real foo[nfoo] = {mass, mom[0], mom[1], mom[2],
-                          com[0], com[1], com[2],
-                          ang_mom[0], ang_mom[1], ang_mom[2],
-#ifdef HYBRID_MOMENTUM
-                          hyb_mom[0], hyb_mom[1], hyb_mom[2],
-#endif
-#ifdef GRAVITY
-                          rho_e, rho_K, rho_E, rho_phi};
-#else
-                          rho_e, rho_K, rho_E};
-#endif
-
-        const int nfoo_max = 3;
-
-        Real foo_max[nfoo_max] = {T_max, rho_max, ts_te_max};
-
 #ifdef BL_LAZY
         Lazy::QueueReduction( [=] () mutable {
 #endif
 
-        ParallelDescriptor::ReduceRealSum(foo, nfoo, ParallelDescriptor::IOProcessorNumber());
-
-        ParallelDescriptor::ReduceRealMax(foo_max, nfoo_max, ParallelDescriptor::IOProcessorNumber());
-
         if (ParallelDescriptor::IOProcessor()) {
 
-            int i = 0;
-            mass       = foo[i++];
-            mom[0]     = foo[i++];
-            mom[1]     = foo[i++];
-            mom[2]     = foo[i++];
-            com[0]     = foo[i++];
-            com[1]     = foo[i++];
-            com[2]     = foo[i++];
-            ang_mom[0] = foo[i++];
-            ang_mom[1] = foo[i++];
-            ang_mom[2] = foo[i++];
+            mass       = sums[int_sum::mass];
+            mom[0]     = sums[int_sum::xmom];
+            mom[1]     = sums[int_sum::ymom];
+            mom[2]     = sums[int_sum::zmom];
+            com[0]     = sums[int_sum::xcom];
+            com[1]     = sums[int_sum::ycom];
+            com[2]     = sums[int_sum::zcom];
+            ang_mom[0] = sums[int_sum::xang_mom];
+            ang_mom[1] = sums[int_sum::yang_mom];
+            ang_mom[2] = sums[int_sum::zang_mom];
 #ifdef HYBRID_MOMENTUM
-            hyb_mom[0] = foo[i++];
-            hyb_mom[1] = foo[i++];
-            hyb_mom[2] = foo[i++];
+            hyb_mom[0] = sums[int_sum::rmom_hyb];
+            hyb_mom[1] = sums[int_sum::lmom_hyb];
+            hyb_mom[2] = sums[int_sum::pmom_hyb];
 #endif
-            rho_e      = foo[i++];
-            rho_K      = foo[i++];
-            rho_E      = foo[i++];
+            rho_e      = sums[int_sum::rho_e];
+            rho_K      = sums[int_sum::rho_K];
+            rho_E      = sums[int_sum::rho_E];
 #ifdef GRAVITY
-            rho_phi    = foo[i++];
+            rho_phi    = sums[int_sum::rho_phi];
 
             // Total energy is 1/2 * rho * phi + rho * E for self-gravity,
             // and rho * phi + rho * E for externally-supplied gravity.
@@ -271,10 +114,9 @@ Castro::sum_integrated_quantities ()
                 com_vel[idir] = mom[idir] / mass;
             }
 
-            i = 0;
-            T_max     = foo_max[i++];
-            rho_max   = foo_max[i++];
-            ts_te_max = foo_max[i++];    // NOLINT(clang-analyzer-deadcode.DeadStores)
+            T_max     = maxes[int_sum::T_max];
+            rho_max   = maxes[int_sum::rho_max];
+            ts_te_max = maxes[int_sum::ts_te_max];    // NOLINT(clang-analyzer-deadcode.DeadStores)
 
             std::cout << '\n';
             std::cout << "TIME= " << time << " MASS        = "   << mass      << '\n';
@@ -445,6 +287,7 @@ Castro::sum_integrated_quantities ()
 
 #if (AMREX_SPACEDIM > 1)
             // Gravitational wave signal. This is designed to add to these quantities so we can send them directly.
+            bool local_flag = true;
             ca_lev.gwstrain(time, h_plus_1, h_cross_1, h_plus_2, h_cross_2, h_plus_3, h_cross_3, local_flag);
 #endif
 
@@ -539,7 +382,6 @@ Castro::sum_integrated_quantities ()
     // Species
 
     {
-        std::vector<Real> species_mass(NumSpec);
         std::vector<std::string> species_names(NumSpec);
 
         // Species names
@@ -547,33 +389,17 @@ Castro::sum_integrated_quantities ()
         for (int i = 0; i < NumSpec; i++) {
             species_names[i] = desc_lst[State_Type].name(UFS+i);
             species_names[i] = species_names[i].substr(4,std::string::npos);
-            species_mass[i] = 0.0;
         }
 
-        // Integrated mass of all species on the domain
-
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            MultiFab& S_new = getLevel(lev).get_new_data(State_Type);
-            for (int i = 0; i < NumSpec; ++i) {
-                species_mass[i] += getLevel(lev).volWgtSum(S_new, UFS + i, local_flag) / C::M_solar;
-            }
-        }
-
-        int nfoo_sum = NumSpec;
-
-        amrex::Vector<Real> foo_sum(nfoo_sum);
-
-        for (int i = 0; i < NumSpec; ++i) {
-            foo_sum[i] = species_mass[i];
-        }
+        if (ParallelDescriptor::IOProcessor()) {
 
-        amrex::ParallelDescriptor::ReduceRealSum(foo_sum.dataPtr(), nfoo_sum);
+            // Integrated mass of all species on the domain
 
-        for (int i = 0; i < NumSpec; ++i) {
-            species_mass[i] = foo_sum[i];
-        }
+            std::vector<Real> species_mass(NumSpec);
 
-        if (ParallelDescriptor::IOProcessor()) {
+            for (int i = 0; i < NumSpec; i++) {
+                species_mass[i] = sums[int_sum::spec + i] / C::M_solar;
+            }
 
             std::ostream& log = *Castro::data_logs[2];
 
@@ -659,6 +485,14 @@ Castro::sum_integrated_quantities ()
             }
         }
 
+        // Calculate the number of retries so far per subcycle
+        // attempted (summed over all levels).
+
+        Real retry_rate = 0.0_rt;
+        if (num_advance_attempts > 0) {
+            retry_rate = static_cast<Real>(num_advance_retries) / static_cast<Real>(num_advance_attempts);
+        }
+
         if (ParallelDescriptor::IOProcessor()) {
 
             std::ostream& log = *Castro::data_logs[3];
@@ -679,6 +513,7 @@ Castro::sum_integrated_quantities ()
                 header << std::setw(datwidth) << "  MAXIMUM GPU MEMORY USED"; ++n;
                 header << std::setw(datwidth) << "  MINIMUM GPU MEMORY FREE"; ++n;
 #endif
+                header << std::setw(datwidth) << "       ADVANCE RETRY RATE"; ++n;
 
                 header << std::endl;
 
@@ -724,6 +559,7 @@ Castro::sum_integrated_quantities ()
             log << std::setw(datwidth)                                    << gpu_size_used_MB;
             log << std::setw(datwidth)                                    << gpu_size_free_MB;
 #endif
+            log << std::setw(datwidth) << std::setprecision(datprecision) << retry_rate;
 
             log << std::endl;
 
@@ -16,7 +16,7 @@ using namespace amrex;
 Real
 Castro::volWgtSum (const std::string& name, Real time, bool local, bool finemask)
 {
-    auto mf = derive(name, time, 0);
+    auto mf = derive_cached(name, time, 0);
 
     BL_ASSERT(mf);
 
@@ -44,7 +44,19 @@ Castro::volWgtSum (const MultiFab& mf, int comp, bool local, bool finemask)
     {
         auto const& fab = mf[mfi].array(comp);
         auto const& vol = volume.array(mfi);
-        auto const& mask = mask_available ? mask_mf.array(mfi) : Array4<Real>{};
+
+        // Boxes entirely covered by the finer level don't contribute,
+        // and only partly covered ones need the mask.
+
+        const int coverage = mask_available ? fine_mask_coverage_of(mfi) : fine_coverage::none;
+
+        if (coverage == fine_coverage::full) {
+            continue;
+        }
+
+        const bool use_mask = coverage == fine_coverage::partial;
+
+        auto const& mask = use_mask ? mask_mf.array(mfi) : Array4<Real>{};
 
         const Box& box = mfi.tilebox();
 
@@ -56,7 +68,7 @@ Castro::volWgtSum (const MultiFab& mf, int comp, bool local, bool finemask)
         reduce_op.eval(box, reduce_data,
         [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
         {
-            Real maskFactor = mask_available ? mask(i,j,k) : 1.0_rt;
+            Real maskFactor = use_mask ? mask(i,j,k) : 1.0_rt;
 
             return {fab(i,j,k) * vol(i,j,k) * maskFactor};
         });
@@ -76,7 +88,7 @@ Castro::volWgtSum (const MultiFab& mf, int comp, bool local, bool finemask)
 Real
 Castro::locWgtSum (const std::string& name, Real time, int idir, bool local)
 {
-    auto mf = derive(name, time, 0);
+    auto mf = derive_cached(name, time, 0);
 
     BL_ASSERT(mf);
 
@@ -107,7 +119,16 @@ Castro::locWgtSum (const MultiFab& mf, int comp, int idir, bool local)
     {
         auto const& fab = mf[mfi].array(comp);
         auto const& vol = volume.array(mfi);
-        auto const& mask = mask_available ? mask_mf.array(mfi) : Array4<Real>{};
+
+        const int coverage = mask_available ? fine_mask_coverage_of(mfi) : fine_coverage::none;
+
+        if (coverage == fine_coverage::full) {
+            continue;
+        }
+
+        const bool use_mask = coverage == fine_coverage::partial;
+
+        auto const& mask = use_mask ? mask_mf.array(mfi) : Array4<Real>{};
 
         const Box& box = mfi.tilebox();
 
@@ -119,7 +140,7 @@ Castro::locWgtSum (const MultiFab& mf, int comp, int idir, bool local)
         reduce_op.eval(box, reduce_data,
         [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
         {
-            Real maskFactor = mask_available ? mask(i,j,k) : 1.0_rt;
+            Real maskFactor = use_mask ? mask(i,j,k) : 1.0_rt;
 
             Real loc[3];
 
@@ -168,8 +189,8 @@ Castro::volProductSum (const std::string& name1,
                        const std::string& name2,
                        Real time, bool local)
 {
-    auto mf1 = derive(name1, time, 0);
-    auto mf2 = derive(name2, time, 0);
+    auto mf1 = derive_cached(name1, time, 0);
+    auto mf2 = derive_cached(name2, time, 0);
 
     BL_ASSERT(mf1);
     BL_ASSERT(mf2);
@@ -202,14 +223,23 @@ Castro::volProductSum (const MultiFab& mf1,
         auto const& fab1 = mf1[mfi].array(comp1);
         auto const& fab2 = mf2[mfi].array(comp2);
         auto const& vol  = volume.array(mfi);
-        auto const& mask = mask_available ? mask_mf.array(mfi) : Array4<Real>{};
+
+        const int coverage = mask_available ? fine_mask_coverage_of(mfi) : fine_coverage::none;
+
+        if (coverage == fine_coverage::full) {
+            continue;
+        }
+
+        const bool use_mask = coverage == fine_coverage::partial;
+
+        auto const& mask = use_mask ? mask_mf.array(mfi) : Array4<Real>{};
 
         const Box& box = mfi.tilebox();
 
         reduce_op.eval(box, reduce_data,
         [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
         {
-            Real maskFactor = mask_available ? mask(i,j,k) : 1.0_rt;
+            Real maskFactor = use_mask ? mask(i,j,k) : 1.0_rt;
 
             return {fab1(i,j,k) * fab2(i,j,k) * vol(i,j,k) * maskFactor};
         });
@@ -233,7 +263,7 @@ Castro::locSquaredSum (const std::string& name,
 {
     BL_PROFILE("Castro::locSquaredSum()");
 
-    auto mf = derive(name, time, 0);
+    auto mf = derive_cached(name, time, 0);
 
     BL_ASSERT(mf);
 
@@ -255,14 +285,23 @@ Castro::locSquaredSum (const std::string& name,
     for (MFIter mfi(*mf, TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         auto const& fab = (*mf).array(mfi);
-        auto const& mask = mask_available ? mask_mf.array(mfi) : Array4<Real>{};
+
+        const int coverage = mask_available ? fine_mask_coverage_of(mfi) : fine_coverage::none;
+
+        if (coverage == fine_coverage::full) {
+            continue;
+        }
+
+        const bool use_mask = coverage == fine_coverage::partial;
+
+        auto const& mask = use_mask ? mask_mf.array(mfi) : Array4<Real>{};
 
         const Box& box = mfi.tilebox();
 
         reduce_op.eval(box, reduce_data,
         [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
         {
-            Real maskFactor = mask_available ? mask(i,j,k) : 1.0_rt;
+            Real maskFactor = use_mask ? mask(i,j,k) : 1.0_rt;
 
             Real loc[3];
 
@@ -309,6 +348,202 @@ Castro::locSquaredSum (const std::string& name,
     return sum;
 }
 
+void
+Castro::integrated_quantities_sweep (Vector<Real>& sums, Vector<Real>& maxes)
+{
+    BL_PROFILE("Castro::integrated_quantities_sweep()");
+
+    constexpr int nsum = int_sum::nsum;
+    constexpr int nred = int_sum::nsum + int_sum::nmax;
+
+    AMREX_ASSERT(sums.size() == nsum);
+    AMREX_ASSERT(maxes.size() == int_sum::nmax);
+
+    const MultiFab& S_new = get_new_data(State_Type);
+
+#ifdef GRAVITY
+    const bool do_rho_phi = gravity->get_gravity_type() == "PoissonGrav";
+    const MultiFab& phi_new = get_new_data(PhiGrav_Type);
+#endif
+#ifdef REACTIONS
+    const MultiFab& R_new = get_new_data(Reactions_Type);
+#endif
+
+    bool mask_available = level < parent->finestLevel();
+
+    MultiFab tmp_mf;
+    const MultiFab& mask_mf = mask_available ? getLevel(level+1).build_fine_mask() : tmp_mf;
+
+    using ReduceOpsType = TypeMultiplier<ReduceOps, ReduceOpSum[nsum], ReduceOpMax[int_sum::nmax]>;
+    using ReduceDataType = TypeMultiplier<ReduceData, Real[nred]>;
+
+    ReduceOpsType reduce_op;
+    ReduceDataType reduce_data(reduce_op);
+    using ReduceTuple = typename ReduceDataType::Type;
+
+    auto dx     = geom.CellSizeArray();
+    auto problo = geom.ProbLoArray();
+
+#ifdef REACTIONS
+    Real dd = 0.0_rt;
+#if AMREX_SPACEDIM == 1
+    dd = dx[0];
+#elif AMREX_SPACEDIM == 2
+    dd = amrex::min(dx[0], dx[1]);
+#else
+    dd = amrex::min(dx[0], dx[1], dx[2]);
+#endif
+#endif
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel
+#endif
+    for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        auto const& U = S_new.array(mfi);
+#ifdef GRAVITY
+        auto const& phi = phi_new.array(mfi);
+#endif
+#ifdef REACTIONS
+        auto const& R = R_new.array(mfi);
+#endif
+        auto const& vol = volume.array(mfi);
+
+        const int coverage = mask_available ? fine_mask_coverage_of(mfi) : fine_coverage::none;
+
+        if (coverage == fine_coverage::full) {
+            continue;
+        }
+
+        const bool use_mask = coverage == fine_coverage::partial;
+
+        auto const& mask = use_mask ? mask_mf.array(mfi) : Array4<Real>{};
+
+        const Box& box = mfi.tilebox();
+
+        reduce_op.eval(box, reduce_data,
+        [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
+        {
+            Real maskFactor = use_mask ? mask(i,j,k) : 1.0_rt;
+
+            Real dV = vol(i,j,k) * maskFactor;
+
+            Real loc[3];
+
+            loc[0] = problo[0] + (0.5_rt + i) * dx[0];
+
+#if AMREX_SPACEDIM >= 2
+            loc[1] = problo[1] + (0.5_rt + j) * dx[1];
+#else
+            loc[1] = 0.0_rt;
+#endif
+
+#if AMREX_SPACEDIM == 3
+            loc[2] = problo[2] + (0.5_rt + k) * dx[2];
+#else
+            loc[2] = 0.0_rt;
+#endif
+
+            // Angular momentum is measured relative to the center.
+
+            Real r[3] = {loc[0], loc[1], loc[2]};
+
+            for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                r[dir] -= problem::center[dir];
+            }
+
+            Real rho = U(i,j,k,URHO);
+            Real mom[3] = {U(i,j,k,UMX), U(i,j,k,UMY), U(i,j,k,UMZ)};
+
+            Real q[nred];
+
+            q[int_sum::mass] = rho * dV;
+
+            q[int_sum::xmom] = mom[0] * dV;
+            q[int_sum::ymom] = mom[1] * dV;
+            q[int_sum::zmom] = mom[2] * dV;
+
+            q[int_sum::xcom] = rho * dV * loc[0];
+            q[int_sum::ycom] = rho * dV * loc[1];
+            q[int_sum::zcom] = rho * dV * loc[2];
+
+            q[int_sum::xang_mom] = (r[1] * mom[2] - r[2] * mom[1]) * dV;
+            q[int_sum::yang_mom] = (r[2] * mom[0] - r[0] * mom[2]) * dV;
+            q[int_sum::zang_mom] = (r[0] * mom[1] - r[1] * mom[0]) * dV;
+
+#ifdef HYBRID_MOMENTUM
+            q[int_sum::rmom_hyb] = U(i,j,k,UMR) * dV;
+            q[int_sum::lmom_hyb] = U(i,j,k,UML) * dV;
+            q[int_sum::pmom_hyb] = U(i,j,k,UMP) * dV;
+#endif
+
+            q[int_sum::rho_e] = U(i,j,k,UEINT) * dV;
+            q[int_sum::rho_K] = 0.5_rt / rho * (mom[0] * mom[0] + mom[1] * mom[1] + mom[2] * mom[2]) * dV;
+            q[int_sum::rho_E] = U(i,j,k,UEDEN) * dV;
+
+#ifdef GRAVITY
+            q[int_sum::rho_phi] = do_rho_phi ? rho * phi(i,j,k) * dV : 0.0_rt;
+#endif
+
+            for (int n = 0; n < NumSpec; ++n) {
+                q[int_sum::spec + n] = U(i,j,k,UFS+n) * dV;
+            }
+
+            // Extrema
+
+            Real T_max = U(i,j,k,UTEMP) * maskFactor;
+            Real rho_max = rho * maskFactor;
+            Real ts_te = 0.0_rt;
+
+#ifdef REACTIONS
+            Real enuc = std::abs(R(i,j,k,0)) / rho;
+
+            if (enuc > 1.e-100_rt && maskFactor == 1.0_rt) {
+
+                Real rhoInv = 1.0_rt / rho;
+
+                // Calculate sound speed
+                eos_rep_t eos_state;
+                eos_state.rho = rho;
+                eos_state.T   = U(i,j,k,UTEMP);
+                eos_state.e   = U(i,j,k,UEINT) * rhoInv;
+                for (int n = 0; n < NumSpec; ++n) {
+                    eos_state.xn[n] = U(i,j,k,UFS+n) * rhoInv;
+                }
+#if NAUX_NET > 0
+                for (int n = 0; n < NumAux; ++n) {
+                    eos_state.aux[n] = U(i,j,k,UFX+n) * rhoInv;
+                }
+#endif
+
+                eos(eos_input_re, eos_state);
+
+                Real t_e = eos_state.e / enuc;
+                Real t_s = dd / eos_state.cs;
+
+                ts_te = t_s / t_e;
+            }
+#endif
+
+            q[nsum + int_sum::T_max] = T_max;
+            q[nsum + int_sum::rho_max] = rho_max;
+            q[nsum + int_sum::ts_te_max] = ts_te;
+
+            ReduceTuple t;
+            constexpr_for<0, nred>([&] (auto n) { amrex::get<n>(t) = q[n]; });
+            return t;
+        });
+    }
+
+    ReduceTuple hv = reduce_data.value();
+
+    constexpr_for<0, nsum>([&] (auto n) { sums[n] += amrex::get<n>(hv); });
+
+    constexpr_for<0, int_sum::nmax>([&] (auto n) {
+        maxes[n] = amrex::max(maxes[n], amrex::get<nsum + n>(hv));
+    });
+}
+
 
 
 #ifdef GRAVITY
@@ -368,7 +603,16 @@ Castro::gwstrain (Real time,
         auto gravx = grav_new[mfi].array(0);
         auto gravy = grav_new[mfi].array(1);
         auto gravz = grav_new[mfi].array(2);
-        auto const& mask = mask_available ? mask_mf.array(mfi) : Array4<Real>{};
+
+        const int coverage = mask_available ? fine_mask_coverage_of(mfi) : fine_coverage::none;
+
+        if (coverage == fine_coverage::full) {
+            continue;
+        }
+
+        const bool use_mask = coverage == fine_coverage::partial;
+
+        auto const& mask = use_mask ? mask_mf.array(mfi) : Array4<Real>{};
 
         // Calculate the second time derivative of the quadrupole moment tensor,
         // according to the formula in Equation 6.5 of Blanchet, Damour and Schafer 1990.
@@ -379,7 +623,7 @@ Castro::gwstrain (Real time,
         reduce_op.eval(box, reduce_data,
         [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k) -> ReduceTuple
         {
-            Real maskFactor = mask_available ? mask(i,j,k) : 1.0_rt;
+            Real maskFactor = use_mask ? mask(i,j,k) : 1.0_rt;
 
             GpuArray<Real, 3> r;
             position(i, j, k, geomdata, r);
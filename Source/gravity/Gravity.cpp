@@ -92,6 +92,8 @@ Gravity::Gravity(Amr* Parent, int _finest_level, BCRec* _phys_bc, int _density)
      radial_pres.resize(MAX_LEV);
 #endif
 
+     multipole_basis.resize(MAX_LEV);
+
      if (gravity::gravity_type == "PoissonGrav") {
          make_mg_bc();
          init_multipole_grav();
@@ -307,6 +309,14 @@ Gravity::install_level (int                   level,
            grad_phi_curr[level][n] = std::make_unique<MultiFab>(level_data->getEdgeBoxArray(n),dm,1,1);
        }
 
+       // The grids at this level have changed, so any cached multipole
+       // basis functions are no longer valid.
+
+       multipole_basis[level].reset();
+       if (level == 0) {
+           multipole_bc_tables.clear();
+       }
+
     } else if (gravity::gravity_type == "MonopoleGrav") {
 
         if (!geom.isAllPeriodic())
@@ -1434,7 +1444,10 @@ Gravity::interpolate_monopole_grav(int level, RealVector& radial_grav, MultiFab&
 
 void
 Gravity::compute_radial_mass(const Box& bx,
-                             Array4<Real const> const u,
+                             Array4<Real const> const u_old,
+                             Array4<Real const> const u_new,
+                             Real alpha,
+                             Array4<Real const> const mask,
                              RealVector& radial_mass_local,
                              RealVector& radial_vol_local,
 #ifdef GR_GRAV
@@ -1496,9 +1509,26 @@ Gravity::compute_radial_mass(const Box& bx,
     Real* const radial_pres_ptr = radial_pres_local.dataPtr();
 #endif
 
+    const Real omalpha = 1.0_rt - alpha;
+    const bool mask_available = mask.dataPtr() != nullptr;
+
     amrex::ParallelFor(bx,
     [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
     {
+        // Time-interpolate a single component of the state. We only
+        // touch the old or new state when it actually contributes.
+
+        auto u = [=] (int n) -> Real
+        {
+            if (alpha == 1.0_rt) {
+                return u_new(i,j,k,n);
+            } else if (alpha == 0.0_rt) {
+                return u_old(i,j,k,n);
+            } else {
+                return omalpha * u_old(i,j,k,n) + alpha * u_new(i,j,k,n);
+            }
+        };
+
         GpuArray<Real, 3> loc;
         loc[0] = problo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0] - problem::center[0];
         Real lo_i = problo[0] + static_cast<Real>(i) * dx[0] - problem::center[0];
@@ -1514,27 +1544,33 @@ Gravity::compute_radial_mass(const Box& bx,
 
         // We may be coming in here with a masked out zone (in a zone on a coarse
         // level underlying a fine level). We don't want to be calling the EOS in
-        // this case, so we'll skip these masked out zones (which will have rho
-        // exactly equal to zero).
+        // this case, so we'll skip these masked out zones (and any zones with
+        // rho exactly equal to zero).
+
+        if (mask_available && mask(i,j,k) == 0.0_rt) {
+            return;
+        }
+
+        const Real rho = u(URHO);
 
-        if (u(i,j,k,URHO) == 0.0_rt) {
+        if (rho == 0.0_rt) {
             return;
         }
 
 #ifdef GR_GRAV
-        Real rhoInv = 1.0_rt / u(i,j,k,URHO);
+        Real rhoInv = 1.0_rt / rho;
 
         eos_t eos_state;
 
-        eos_state.rho = u(i,j,k,URHO);
-        eos_state.e   = u(i,j,k,UEINT) * rhoInv;
-        eos_state.T   = u(i,j,k,UTEMP);
+        eos_state.rho = rho;
+        eos_state.e   = u(UEINT) * rhoInv;
+        eos_state.T   = u(UTEMP);
         for (int n = 0; n < NumSpec; ++n) {
-            eos_state.xn[n] = u(i,j,k,UFS+n) * rhoInv;
+            eos_state.xn[n] = u(UFS+n) * rhoInv;
         }
 #if NAUX_NET > 0
         for (int n = 0; n < NumAux; ++n) {
-            eos_state.aux[n] = u(i,j,k,UFX+n) * rhoInv;
+            eos_state.aux[n] = u(UFX+n) * rhoInv;
         }
 #endif
 
@@ -1590,7 +1626,7 @@ Gravity::compute_radial_mass(const Box& bx,
                         }
 
                         if (index <= n1d - 1) {
-                            Gpu::Atomic::Add(&radial_mass_ptr[index], vol_frac * u(i,j,k,URHO));
+                            Gpu::Atomic::Add(&radial_mass_ptr[index], vol_frac * rho);
                             Gpu::Atomic::Add(&radial_vol_ptr[index], vol_frac);
 #ifdef GR_GRAV
                             Gpu::Atomic::Add(&radial_pres_ptr[index], vol_frac * eos_state.p);
@@ -1831,6 +1867,32 @@ Gravity::fill_multipole_BCs(int crse_level, int fine_level, const Vector<MultiFa
     const int boundary_only = 1;
 #endif
 
+    // If requested, use the cached basis functions to compute the moments
+    // and the boundary values.  These depend on the center, so throw them
+    // out if it has moved.
+
+    const bool use_cache = gravity::multipole_cache_max_level >= 0 && boundary_only == 1;
+
+    if (use_cache) {
+        bool center_moved = false;
+        for (int n = 0; n < 3; ++n) {
+            if (multipole_basis_center[n] != problem::center[n]) {
+                center_moved = true;
+            }
+        }
+
+        if (center_moved) {
+            for (auto& basis : multipole_basis) {
+                basis.reset();
+            }
+            multipole_bc_tables.clear();
+
+            for (int n = 0; n < 3; ++n) {
+                multipole_basis_center[n] = problem::center[n];
+            }
+        }
+    }
+
     // Use all available data in constructing the boundary conditions,
     // unless the user has indicated that a maximum level at which
     // to stop using the more accurate data.
@@ -1854,6 +1916,14 @@ Gravity::fill_multipole_BCs(int crse_level, int fine_level, const Vector<MultiFa
             }
         }
 
+        const bool use_basis = use_cache && lev <= gravity::multipole_cache_max_level;
+
+        if (use_basis && (multipole_basis[lev] == nullptr ||
+                          multipole_basis[lev]->boxArray() != source.boxArray() ||
+                          multipole_basis[lev]->DistributionMap() != source.DistributionMap())) {
+            build_multipole_basis(lev, source);
+        }
+
         // Loop through the grids and compute the individual contributions
         // to the various moments. The multipole moment constructor
         // is coded to only add to the moment arrays, so it is safe
@@ -1915,6 +1985,20 @@ Gravity::fill_multipole_BCs(int crse_level, int fine_level, const Vector<MultiFa
                 auto rho = source[mfi].array();
                 auto vol = (*volume[lev])[mfi].array();
 
+                if (use_basis) {
+
+                    auto basis = multipole_basis[lev]->const_array(mfi);
+
+                    amrex::ParallelFor(amrex::Gpu::KernelInfo().setReduction(true), bx,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k, amrex::Gpu::Handler const& handler) noexcept
+                    {
+                        multipole_basis_reduce(rho(i,j,k), basis, i, j, k,
+                                               qL0_arr, qLC_arr, qLS_arr, npts-1, handler);
+                    });
+
+                    continue;
+                }
+
                 amrex::ParallelFor(amrex::Gpu::KernelInfo().setReduction(true), bx,
                 [=] AMREX_GPU_DEVICE (int i, int j, int k, amrex::Gpu::Handler const& handler) noexcept
                 {
@@ -2160,164 +2244,201 @@ Gravity::fill_multipole_BCs(int crse_level, int fine_level, const Vector<MultiFa
     // complete multipole moments, for all points on the
     // boundary that are held on this process.
 
-    const Box& domain = parent->Geom(crse_level).Domain();
-    const auto dx = parent->Geom(crse_level).CellSizeArray();
-    const auto problo = parent->Geom(crse_level).ProbLoArray();
-    int coord_type = parent->Geom(crse_level).Coord();
+    if (use_cache) {
+
+        if (multipole_bc_tables.empty() ||
+            multipole_bc_ba != phi.boxArray() ||
+            multipole_bc_dm != phi.DistributionMap() ||
+            multipole_bc_ngrow != phi.nGrowVect()) {
+            build_multipole_bc_tables(crse_level, phi);
+        }
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
-    for (MFIter mfi(phi, TilingIfNotGPU()); mfi.isValid(); ++mfi)
-    {
-        const Box& bx = mfi.growntilebox();
+        for (MFIter mfi(phi); mfi.isValid(); ++mfi)
+        {
+            auto qL0_arr = qL0.const_array();
+            auto qLC_arr = qLC.const_array();
+            auto qLS_arr = qLS.const_array();
+            auto phi_arr = phi[mfi].array();
 
-        auto qL0_arr = qL0.array();
-        auto qLC_arr = qLC.array();
-        auto qLS_arr = qLS.array();
-        auto phi_arr = phi[mfi].array();
+            for (const auto& table : multipole_bc_tables[mfi.LocalIndex()]) {
 
-        amrex::ParallelFor(bx,
-        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-        {
-            const int* domlo = domain.loVect();
-            const int* domhi = domain.hiVect();
+                auto basis = table.const_array();
 
-            // If we're using this to construct boundary values, then only use
-            // the outermost bin.
+                amrex::ParallelFor(table.box(),
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                {
+                    phi_arr(i,j,k) = multipole_bc_phi(basis, i, j, k, qL0_arr, qLC_arr, qLS_arr, npts-1);
+                });
 
-            int nlo = 0;
-            if (boundary_only == 1) {
-                nlo = npts-1;
             }
+        }
 
-            Real rmax_cubed = multipole::rmax * multipole::rmax * multipole::rmax;
+    }
+    else {
 
-            Real x;
-            if (i > domhi[0]) {
-                x = problo[0] + (static_cast<Real>(i  )         ) * dx[0] - problem::center[0];
-            }
-            else if (i < domlo[0]) {
-                x = problo[0] + (static_cast<Real>(i+1)         ) * dx[0] - problem::center[0];
-            }
-            else {
-                x = problo[0] + (static_cast<Real>(i  ) + 0.5_rt) * dx[0] - problem::center[0];
-            }
+        const Box& domain = parent->Geom(crse_level).Domain();
+        const auto dx = parent->Geom(crse_level).CellSizeArray();
+        const auto problo = parent->Geom(crse_level).ProbLoArray();
+        int coord_type = parent->Geom(crse_level).Coord();
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (MFIter mfi(phi, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.growntilebox();
+
+            auto qL0_arr = qL0.array();
+            auto qLC_arr = qLC.array();
+            auto qLS_arr = qLS.array();
+            auto phi_arr = phi[mfi].array();
 
-            x = x / multipole::rmax;
+            amrex::ParallelFor(bx,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                const int* domlo = domain.loVect();
+                const int* domhi = domain.hiVect();
+
+                // If we're using this to construct boundary values, then only use
+                // the outermost bin.
+
+                int nlo = 0;
+                if (boundary_only == 1) {
+                    nlo = npts-1;
+                }
+
+                Real rmax_cubed = multipole::rmax * multipole::rmax * multipole::rmax;
+
+                Real x;
+                if (i > domhi[0]) {
+                    x = problo[0] + (static_cast<Real>(i  )         ) * dx[0] - problem::center[0];
+                }
+                else if (i < domlo[0]) {
+                    x = problo[0] + (static_cast<Real>(i+1)         ) * dx[0] - problem::center[0];
+                }
+                else {
+                    x = problo[0] + (static_cast<Real>(i  ) + 0.5_rt) * dx[0] - problem::center[0];
+                }
+
+                x = x / multipole::rmax;
 
 #if AMREX_SPACEDIM >= 2
-            Real y;
-            if (j > domhi[1]) {
-                y = problo[1] + (static_cast<Real>(j  )         ) * dx[1] - problem::center[1];
-            }
-            else if (j < domlo[1]) {
-                y = problo[1] + (static_cast<Real>(j+1)         ) * dx[1] - problem::center[1];
-            }
-            else {
-                y = problo[1] + (static_cast<Real>(j  ) + 0.5_rt) * dx[1] - problem::center[1];
-            }
+                Real y;
+                if (j > domhi[1]) {
+                    y = problo[1] + (static_cast<Real>(j  )         ) * dx[1] - problem::center[1];
+                }
+                else if (j < domlo[1]) {
+                    y = problo[1] + (static_cast<Real>(j+1)         ) * dx[1] - problem::center[1];
+                }
+                else {
+                    y = problo[1] + (static_cast<Real>(j  ) + 0.5_rt) * dx[1] - problem::center[1];
+                }
 #else
-            Real y = 0.0_rt;
+                Real y = 0.0_rt;
 #endif
 
-            y = y / multipole::rmax;
+                y = y / multipole::rmax;
 
 #if AMREX_SPACEDIM == 3
-            Real z;
-            if (k > domhi[2]) {
-                z = problo[2] + (static_cast<Real>(k  )         ) * dx[2] - problem::center[2];
-            }
-            else if (k < domlo[2]) {
-                z = problo[2] + (static_cast<Real>(k+1)         ) * dx[2] - problem::center[2];
-            }
-            else {
-                z = problo[2] + (static_cast<Real>(k  ) + 0.5_rt) * dx[2] - problem::center[2];
-            }
+                Real z;
+                if (k > domhi[2]) {
+                    z = problo[2] + (static_cast<Real>(k  )         ) * dx[2] - problem::center[2];
+                }
+                else if (k < domlo[2]) {
+                    z = problo[2] + (static_cast<Real>(k+1)         ) * dx[2] - problem::center[2];
+                }
+                else {
+                    z = problo[2] + (static_cast<Real>(k  ) + 0.5_rt) * dx[2] - problem::center[2];
+                }
 #else
-            Real z = 0.0;
+                Real z = 0.0;
 #endif
 
-            z = z / multipole::rmax;
+                z = z / multipole::rmax;
 
-            // Only adjust ghost zones here
+                // Only adjust ghost zones here
 
-            if (i < domlo[0] || i > domhi[0]
+                if (i < domlo[0] || i > domhi[0]
 #if AMREX_SPACEDIM >= 2
-                || j < domlo[1] || j > domhi[1]
+                    || j < domlo[1] || j > domhi[1]
 #endif
 #if AMREX_SPACEDIM >= 3
-                || k < domlo[2] || k > domhi[2]
+                    || k < domlo[2] || k > domhi[2]
 #endif
-                ) {
+                    ) {
 
-                // There are some cases where r == 0. This might occur, for example,
-                // when we have symmetric BCs and our corner is at one edge.
-                // In this case, we'll set phi to zero for safety, to avoid NaN issues.
-                // These cells should not be accessed anyway during the gravity solve.
+                    // There are some cases where r == 0. This might occur, for example,
+                    // when we have symmetric BCs and our corner is at one edge.
+                    // In this case, we'll set phi to zero for safety, to avoid NaN issues.
+                    // These cells should not be accessed anyway during the gravity solve.
 
-                Real r = std::sqrt(x * x + y * y + z * z);
+                    Real r = std::sqrt(x * x + y * y + z * z);
 
-                if (r < 1.0e-12_rt) {
-                    phi_arr(i,j,k) = 0.0_rt;
-                    return;
-                }
+                    if (r < 1.0e-12_rt) {
+                        phi_arr(i,j,k) = 0.0_rt;
+                        return;
+                    }
 
-                Real cosTheta{}, phiAngle{};
-                if (AMREX_SPACEDIM == 3) {
-                    cosTheta = z / r;
-                    phiAngle = std::atan2(y, x);
-                }
-                else if (AMREX_SPACEDIM == 2 && coord_type == 1) {
-                    cosTheta = y / r;
-                    phiAngle = 0.0_rt;
-                }
+                    Real cosTheta{}, phiAngle{};
+                    if (AMREX_SPACEDIM == 3) {
+                        cosTheta = z / r;
+                        phiAngle = std::atan2(y, x);
+                    }
+                    else if (AMREX_SPACEDIM == 2 && coord_type == 1) {
+                        cosTheta = y / r;
+                        phiAngle = 0.0_rt;
+                    }
 
-                phi_arr(i,j,k) = 0.0_rt;
+                    phi_arr(i,j,k) = 0.0_rt;
 
-                // Compute the potentials on the ghost cells.
+                    // Compute the potentials on the ghost cells.
 
-                Real legPolyL, legPolyL1, legPolyL2;
-                Real assocLegPolyLM, assocLegPolyLM1, assocLegPolyLM2;
+                    Real legPolyL, legPolyL1, legPolyL2;
+                    Real assocLegPolyLM, assocLegPolyLM1, assocLegPolyLM2;
 
-                for (int n = nlo; n <= npts - 1; ++n) {
+                    for (int n = nlo; n <= npts - 1; ++n) {
 
-                    for (int l = 0; l <= gravity::lnum; ++l) {
+                        for (int l = 0; l <= gravity::lnum; ++l) {
 
-                        calcLegPolyL(l, legPolyL, legPolyL1, legPolyL2, cosTheta);
+                            calcLegPolyL(l, legPolyL, legPolyL1, legPolyL2, cosTheta);
 
-                        Real r_U = std::pow(r, -l-1);
+                            Real r_U = std::pow(r, -l-1);
 
-                        // Make sure we undo the volume scaling here.
+                            // Make sure we undo the volume scaling here.
 
-                        phi_arr(i,j,k) += qL0_arr(l,0,n) * legPolyL * r_U * rmax_cubed;
+                            phi_arr(i,j,k) += qL0_arr(l,0,n) * legPolyL * r_U * rmax_cubed;
 
-                    }
+                        }
 
-                    for (int m = 1; m <= gravity::lnum; ++m) {
-                        for (int l = 1; l <= gravity::lnum; ++l) {
+                        for (int m = 1; m <= gravity::lnum; ++m) {
+                            for (int l = 1; l <= gravity::lnum; ++l) {
 
-                            if (m > l) {
-                                continue;
-                            }
+                                if (m > l) {
+                                    continue;
+                                }
 
-                            calcAssocLegPolyLM(l, m, assocLegPolyLM, assocLegPolyLM1, assocLegPolyLM2, cosTheta);
+                                calcAssocLegPolyLM(l, m, assocLegPolyLM, assocLegPolyLM1, assocLegPolyLM2, cosTheta);
 
-                            Real r_U = std::pow(r, -l-1);
+                                Real r_U = std::pow(r, -l-1);
 
-                            // Make sure we undo the volume scaling here.
+                                // Make sure we undo the volume scaling here.
 
-                            phi_arr(i,j,k) += (qLC_arr(l,m,n) * std::cos(m * phiAngle) + qLS_arr(l,m,n) * std::sin(m * phiAngle)) *
-                                              assocLegPolyLM * r_U * rmax_cubed;
+                                phi_arr(i,j,k) += (qLC_arr(l,m,n) * std::cos(m * phiAngle) + qLS_arr(l,m,n) * std::sin(m * phiAngle)) *
+                                                  assocLegPolyLM * r_U * rmax_cubed;
 
+                            }
                         }
+
                     }
 
+                    phi_arr(i,j,k) = -C::Gconst * phi_arr(i,j,k) / multipole::rmax;
                 }
+            });
+        }
 
-                phi_arr(i,j,k) = -C::Gconst * phi_arr(i,j,k) / multipole::rmax;
-            }
-        });
     }
 
     if (gravity::verbose)
@@ -2337,6 +2458,227 @@ Gravity::fill_multipole_BCs(int crse_level, int fine_level, const Vector<MultiFa
 
 }
 
+void
+Gravity::build_multipole_basis (int lev, const MultiFab& source)
+{
+    BL_PROFILE("Gravity::build_multipole_basis()");
+
+#if (AMREX_SPACEDIM == 3)
+    const int npts = numpts_at_level;
+#else
+    const int npts = 1;
+#endif
+
+    // We only cache the basis for the boundary conditions, which only
+    // need the outermost bin.
+
+    const int nlo = npts-1;
+
+    multipole_basis[lev] = std::make_unique<MultiFab>(source.boxArray(), source.DistributionMap(),
+                                                      multipole_basis_ncomp(), 0);
+    multipole_basis[lev]->setVal(0.0);
+
+    const auto dx = parent->Geom(lev).CellSizeArray();
+    const auto problo = parent->Geom(lev).ProbLoArray();
+    const auto probhi = parent->Geom(lev).ProbHiArray();
+    int coord_type = parent->Geom(lev).Coord();
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(*multipole_basis[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        const Box& bx = mfi.tilebox();
+
+        auto basis = (*multipole_basis[lev])[mfi].array();
+        auto vol = (*volume[lev])[mfi].array();
+
+        amrex::ParallelFor(bx,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            // This must match the moment calculation in fill_multipole_BCs.
+
+            Real drInv = multipole::rmax / dx[0];
+
+            Real rmax_cubed_inv = 1.0_rt / (multipole::rmax * multipole::rmax * multipole::rmax);
+
+            Real x = (problo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0] - problem::center[0]) / multipole::rmax;
+
+#if AMREX_SPACEDIM >= 2
+            Real y = (problo[1] + (static_cast<Real>(j) + 0.5_rt) * dx[1] - problem::center[1]) / multipole::rmax;
+#else
+            Real y = 0.0_rt;
+#endif
+
+#if AMREX_SPACEDIM == 3
+            Real z = (problo[2] + (static_cast<Real>(k) + 0.5_rt) * dx[2] - problem::center[2]) / multipole::rmax;
+#else
+            Real z = 0.0_rt;
+#endif
+
+            Real r = std::sqrt(x * x + y * y + z * z);
+
+            Real cosTheta{}, phiAngle{};
+            int index{};
+
+            if (AMREX_SPACEDIM == 3) {
+                index = static_cast<int>(r * drInv);
+                cosTheta = z / r;
+                phiAngle = std::atan2(y, x);
+            }
+            else if (AMREX_SPACEDIM == 2 && coord_type == 1) {
+                index = nlo;
+                cosTheta = y / r;
+                phiAngle = z;
+            }
+            else if (AMREX_SPACEDIM == 1 && coord_type == 2) {
+                index = nlo;
+                cosTheta = 1.0_rt;
+                phiAngle = 0.0_rt;
+            }
+
+            // Zones outside of the outermost bin only contribute to the
+            // exterior moments, which are not needed for the boundary.
+
+            if (index > nlo) {
+                return;
+            }
+
+            Real dV = vol(i,j,k) * rmax_cubed_inv;
+
+            multipole_basis_add(cosTheta, phiAngle, r, dV, basis, i, j, k, true);
+
+            if (multipole::doSymmetricAdd) {
+
+                multipole_symmetric_images(x, y, z, problo, probhi,
+                [&] (Real cosTheta_s, Real phiAngle_s, Real r_s)
+                {
+                    multipole_basis_add(cosTheta_s, phiAngle_s, r_s, dV, basis, i, j, k);
+                });
+
+            }
+        });
+    }
+}
+
+void
+Gravity::build_multipole_bc_tables (int crse_level, const MultiFab& phi)
+{
+    BL_PROFILE("Gravity::build_multipole_bc_tables()");
+
+    multipole_bc_ba = phi.boxArray();
+    multipole_bc_dm = phi.DistributionMap();
+    multipole_bc_ngrow = phi.nGrowVect();
+
+    multipole_bc_tables.clear();
+    multipole_bc_tables.resize(phi.local_size());
+
+    const int ncomp = multipole_basis_ncomp();
+
+    const Box& domain = parent->Geom(crse_level).Domain();
+    const auto dx = parent->Geom(crse_level).CellSizeArray();
+    const auto problo = parent->Geom(crse_level).ProbLoArray();
+    int coord_type = parent->Geom(crse_level).Coord();
+
+    const auto domlo = lbound(domain);
+    const auto domhi = ubound(domain);
+
+    for (MFIter mfi(phi); mfi.isValid(); ++mfi)
+    {
+        // Only the ghost zones outside of the domain are filled.
+
+        const BoxList bl = amrex::boxDiff(mfi.fabbox(), domain);
+
+        auto& tables = multipole_bc_tables[mfi.LocalIndex()];
+        tables.reserve(bl.size());
+
+        for (const Box& bx : bl) {
+
+            tables.emplace_back(bx, ncomp);
+
+            auto basis = tables.back().array();
+
+            amrex::ParallelFor(bx,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                // This must match the boundary locations in fill_multipole_BCs.
+
+                Real rmax_cubed = multipole::rmax * multipole::rmax * multipole::rmax;
+
+                Real x;
+                if (i > domhi.x) {
+                    x = problo[0] + (static_cast<Real>(i  )         ) * dx[0] - problem::center[0];
+                }
+                else if (i < domlo.x) {
+                    x = problo[0] + (static_cast<Real>(i+1)         ) * dx[0] - problem::center[0];
+                }
+                else {
+                    x = problo[0] + (static_cast<Real>(i  ) + 0.5_rt) * dx[0] - problem::center[0];
+                }
+
+                x = x / multipole::rmax;
+
+#if AMREX_SPACEDIM >= 2
+                Real y;
+                if (j > domhi.y) {
+                    y = problo[1] + (static_cast<Real>(j  )         ) * dx[1] - problem::center[1];
+                }
+                else if (j < domlo.y) {
+                    y = problo[1] + (static_cast<Real>(j+1)         ) * dx[1] - problem::center[1];
+                }
+                else {
+                    y = problo[1] + (static_cast<Real>(j  ) + 0.5_rt) * dx[1] - problem::center[1];
+                }
+#else
+                Real y = 0.0_rt;
+#endif
+
+                y = y / multipole::rmax;
+
+#if AMREX_SPACEDIM == 3
+                Real z;
+                if (k > domhi.z) {
+                    z = problo[2] + (static_cast<Real>(k  )         ) * dx[2] - problem::center[2];
+                }
+                else if (k < domlo.z) {
+                    z = problo[2] + (static_cast<Real>(k+1)         ) * dx[2] - problem::center[2];
+                }
+                else {
+                    z = problo[2] + (static_cast<Real>(k  ) + 0.5_rt) * dx[2] - problem::center[2];
+                }
+#else
+                Real z = 0.0_rt;
+#endif
+
+                z = z / multipole::rmax;
+
+                Real r = std::sqrt(x * x + y * y + z * z);
+
+                // As in fill_multipole_BCs, we set phi to zero when r == 0.
+
+                if (r < 1.0e-12_rt) {
+                    for (int n = 0; n < ncomp; ++n) {
+                        basis(i,j,k,n) = 0.0_rt;
+                    }
+                    return;
+                }
+
+                Real cosTheta{}, phiAngle{};
+                if (AMREX_SPACEDIM == 3) {
+                    cosTheta = z / r;
+                    phiAngle = std::atan2(y, x);
+                }
+                else if (AMREX_SPACEDIM == 2 && coord_type == 1) {
+                    cosTheta = y / r;
+                    phiAngle = 0.0_rt;
+                }
+
+                multipole_bc_basis(cosTheta, phiAngle, r, rmax_cubed, basis, i, j, k);
+            });
+        }
+    }
+}
+
 #if (AMREX_SPACEDIM == 3)
 void
 Gravity::fill_direct_sum_BCs(int crse_level, int fine_level, const Vector<MultiFab*>& Rhs, MultiFab& phi)
@@ -2361,7 +2703,7 @@ Gravity::fill_direct_sum_BCs(int crse_level, int fine_level, const Vector<MultiF
     const int hiVectXZ[3] = {domhi[0]+1, 0         , domhi[2]+1};
 
     const int loVectYZ[3] = {0         , domlo[1]-1, domlo[2]-1};
-    const int hiVectYZ[3] = {0         , domhi[1]+1, domhi[1]+1};
+    const int hiVectYZ[3] = {0         , domhi[1]+1, domhi[2]+1};
 
     const int bc_lo[3] = {domlo[0]-1, domlo[1]-1, domlo[2]-1};
     const int bc_hi[3] = {domhi[0]+1, domhi[1]+1, domhi[2]+1};
@@ -2431,352 +2773,593 @@ Gravity::fill_direct_sum_BCs(int crse_level, int fine_level, const Vector<MultiF
         physbc_hi[dir] = phys_bc->hi(dir);
     }
 
-    for (int lev = crse_level; lev <= fine_level; ++lev) {
+    if (gravity::direct_sum_bcs_tree) {
 
-        // Create a local copy of the RHS so that we can mask it.
+        // Rather than summing the contribution of every zone to every
+        // boundary point, build a tree of multipole moments over each
+        // grid on this rank and evaluate it at each boundary point
+        // (a Barnes-Hut style approximation).
 
-        MultiFab source(Rhs[lev - crse_level]->boxArray(),
-                        Rhs[lev - crse_level]->DistributionMap(),
-                        1, 0);
+        GpuArray<bool, 3> doSymmetricAddLo {false};
+        GpuArray<bool, 3> doSymmetricAddHi {false};
 
-        MultiFab::Copy(source, *Rhs[lev - crse_level], 0, 0, 1, 0);
+        for (int b = 0; b < 3; ++b) {
+            doSymmetricAddLo[b] = physbc_lo[b] == amrex::PhysBCType::symmetry;
+            doSymmetricAddHi[b] = physbc_hi[b] == amrex::PhysBCType::symmetry;
+        }
+
+        Vector<Vector<FArrayBox>> tree_data;
+        Gpu::ManagedVector<DirectSumTreeView> trees;
+
+        for (int lev = crse_level; lev <= fine_level; ++lev) {
+
+            const MultiFab& source = *Rhs[lev - crse_level];
+
+            MultiFab tmp_mf;
+            const bool mask_available = lev < fine_level;
+            const MultiFab& mask_mf = mask_available ?
+                dynamic_cast<Castro*>(&(parent->getLevel(lev+1)))->build_fine_mask() : tmp_mf;
+
+            const auto dx = parent->Geom(lev).CellSizeArray();
+
+            for (MFIter mfi(source); mfi.isValid(); ++mfi)
+            {
+                Vector<FArrayBox> moments;
+
+                // The finest level of the tree holds the mass in each zone.
+
+                const Box& bx = mfi.validbox();
+
+                moments.emplace_back(bx, direct_sum_tree::ncomp);
+
+                {
+                    auto mom = moments.back().array();
+                    auto rho = source.const_array(mfi);
+                    auto vol = (*volume[lev]).const_array(mfi);
+                    auto mask = mask_available ? mask_mf.const_array(mfi) : Array4<Real const>{};
+
+                    amrex::ParallelFor(bx,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                    {
+                        Real maskFactor = mask_available ? mask(i,j,k) : 1.0_rt;
+                        Real m = rho(i,j,k) * vol(i,j,k) * maskFactor;
+
+                        for (int n = 0; n < direct_sum_tree::ncomp; ++n) {
+                            mom(i,j,k,n) = 0.0_rt;
+                        }
+
+                        mom(i,j,k,direct_sum_tree::M) = m;
+                        mom(i,j,k,direct_sum_tree::Mabs) = std::abs(m);
+                    });
+                }
+
+                // Each coarser level shifts the moments of its (up to)
+                // eight children to its own center.
+
+                Box cbx = bx;
+
+                while (cbx.numPts() > 1) {
+
+                    const int clev = static_cast<int>(moments.size());
+
+                    if (clev >= direct_sum_tree::max_levels) {
+                        amrex::Abort("Gravity::fill_direct_sum_BCs: grid is too large for the direct sum tree");
+                    }
+
+                    cbx.coarsen(2);
+
+                    moments.emplace_back(cbx, direct_sum_tree::ncomp);
+
+                    auto mom = moments[clev].array();
+                    auto fmom = moments[clev-1].const_array();
+
+                    // The center of a child is offset from the center of
+                    // its parent by half of the child's width.
+
+                    GpuArray<Real, 3> half;
+                    for (int n = 0; n < 3; ++n) {
+                        half[n] = 0.5_rt * static_cast<Real>(1 << (clev - 1)) * dx[n];
+                    }
+
+                    amrex::ParallelFor(cbx,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                    {
+                        using namespace direct_sum_tree;
+
+                        for (int n = 0; n < ncomp; ++n) {
+                            mom(i,j,k,n) = 0.0_rt;
+                        }
+
+                        for (int kk = 0; kk <= 1; ++kk) {
+                            for (int jj = 0; jj <= 1; ++jj) {
+                                for (int ii = 0; ii <= 1; ++ii) {
+
+                                    const int fi = 2 * i + ii;
+                                    const int fj = 2 * j + jj;
+                                    const int fk = 2 * k + kk;
+
+                                    if (!fmom.contains(fi, fj, fk)) {
+                                        continue;
+                                    }
+
+                                    const Real m = fmom(fi,fj,fk,M);
+                                    const Real t[3] = {static_cast<Real>(2 * ii - 1) * half[0],
+                                                       static_cast<Real>(2 * jj - 1) * half[1],
+                                                       static_cast<Real>(2 * kk - 1) * half[2]};
+                                    const Real d[3] = {fmom(fi,fj,fk,Dx),
+                                                       fmom(fi,fj,fk,Dy),
+                                                       fmom(fi,fj,fk,Dz)};
+
+                                    mom(i,j,k,M)    += m;
+                                    mom(i,j,k,Mabs) += fmom(fi,fj,fk,Mabs);
+
+                                    mom(i,j,k,Dx) += d[0] + m * t[0];
+                                    mom(i,j,k,Dy) += d[1] + m * t[1];
+                                    mom(i,j,k,Dz) += d[2] + m * t[2];
+
+                                    mom(i,j,k,Qxx) += fmom(fi,fj,fk,Qxx) + 2.0_rt * d[0] * t[0] + m * t[0] * t[0];
+                                    mom(i,j,k,Qyy) += fmom(fi,fj,fk,Qyy) + 2.0_rt * d[1] * t[1] + m * t[1] * t[1];
+                                    mom(i,j,k,Qzz) += fmom(fi,fj,fk,Qzz) + 2.0_rt * d[2] * t[2] + m * t[2] * t[2];
+                                    mom(i,j,k,Qxy) += fmom(fi,fj,fk,Qxy) + d[0] * t[1] + t[0] * d[1] + m * t[0] * t[1];
+                                    mom(i,j,k,Qxz) += fmom(fi,fj,fk,Qxz) + d[0] * t[2] + t[0] * d[2] + m * t[0] * t[2];
+                                    mom(i,j,k,Qyz) += fmom(fi,fj,fk,Qyz) + d[1] * t[2] + t[1] * d[2] + m * t[1] * t[2];
+
+                                }
+                            }
+                        }
+                    });
+
+                }
+
+                tree_data.push_back(std::move(moments));
+
+                DirectSumTreeView tree;
+                tree.nlevels = static_cast<int>(tree_data.back().size());
+                for (int n = 0; n < 3; ++n) {
+                    tree.dx[n] = dx[n];
+                }
+                trees.push_back(tree);
+
+            }
 
-        if (lev < fine_level) {
-            const MultiFab& mask = dynamic_cast<Castro*>(&(parent->getLevel(lev+1)))->build_fine_mask();
-            MultiFab::Multiply(source, mask, 0, 0, 1, 0);
         }
 
-        const auto dx = parent->Geom(lev).CellSizeArray();
+        // Now that all of the trees are built (and their data will no
+        // longer move), point the views at them.
+
+        for (int t = 0; t < static_cast<int>(trees.size()); ++t) {
+            for (int n = 0; n < trees[t].nlevels; ++n) {
+                trees[t].moments[n] = tree_data[t][n].const_array();
+            }
+        }
 
+        Gpu::streamSynchronize();
+
+        const int ntrees = static_cast<int>(trees.size());
+        const DirectSumTreeView* trees_ptr = trees.dataPtr();
+        const Real theta = gravity::direct_sum_bcs_theta;
+
+        // Evaluate the trees at each point on the faces. Each face is
+        // normal to the direction face_dir and is located at face_loc.
+
+        FArrayBox* bc_faces[6] = {&bcXYLo, &bcXYHi, &bcXZLo, &bcXZHi, &bcYZLo, &bcYZHi};
+        const int face_dir[6] = {2, 2, 1, 1, 0, 0};
+        const Real face_loc[6] = {problo[2], probhi[2], problo[1], probhi[1], problo[0], probhi[0]};
+
+        for (int f = 0; f < 6; ++f) {
+
+            const Box face_box = bc_faces[f]->box();
+            const int npts = static_cast<int>(face_box.numPts());
+            Real* bc_ptr = bc_faces[f]->dataPtr();
+
+            const int dir = face_dir[f];
+            const Real loc = face_loc[f];
+
+            auto eval = [=] AMREX_GPU_HOST_DEVICE (int idx) noexcept
+            {
+                const IntVect iv = face_box.atOffset(idx);
+
+                // Note that the boundary conditions on phi are expected to
+                // live directly on the interface, including at the corners.
+
+                GpuArray<Real, 3> locb;
+
+                for (int n = 0; n < 3; ++n) {
+                    if (n == dir) {
+                        locb[n] = loc;
+                    }
+                    else if (iv[n] == bc_lo[n]) {
+                        locb[n] = problo[n];
+                    }
+                    else if (iv[n] == bc_hi[n]) {
+                        locb[n] = probhi[n];
+                    }
+                    else {
+                        locb[n] = problo[n] + (static_cast<Real>(iv[n]) + 0.5_rt) * bc_dx[n];
+                    }
+                }
+
+                GpuArray<GpuArray<Real, 3>, 15> images;
+                const int nimages = direct_sum_symmetric_images(locb, problo, probhi,
+                                                                doSymmetricAddLo, doSymmetricAddHi,
+                                                                images);
+
+                Real dbc = 0.0_rt;
+
+                for (int t = 0; t < ntrees; ++t) {
+                    for (int n = 0; n < nimages; ++n) {
+                        dbc += direct_sum_tree_phi(trees_ptr[t], images[n], problo, theta);
+                    }
+                }
+
+                bc_ptr[idx] += dbc;
+            };
+
+#ifdef AMREX_USE_GPU
+            amrex::ParallelFor(npts, eval);
+#else
 #ifdef _OPENMP
-        int nthreads = omp_get_max_threads();
-        Vector<std::unique_ptr<FArrayBox> > priv_bcXYLo(nthreads);
-        Vector<std::unique_ptr<FArrayBox> > priv_bcXYHi(nthreads);
-        Vector<std::unique_ptr<FArrayBox> > priv_bcXZLo(nthreads);
-        Vector<std::unique_ptr<FArrayBox> > priv_bcXZHi(nthreads);
-        Vector<std::unique_ptr<FArrayBox> > priv_bcYZLo(nthreads);
-        Vector<std::unique_ptr<FArrayBox> > priv_bcYZHi(nthreads);
-        for (int i=0; i<nthreads; i++) {
-            priv_bcXYLo[i].reset(new FArrayBox(boxXY));
-            priv_bcXYHi[i].reset(new FArrayBox(boxXY));
-            priv_bcXZLo[i].reset(new FArrayBox(boxXZ));
-            priv_bcXZHi[i].reset(new FArrayBox(boxXZ));
-            priv_bcYZLo[i].reset(new FArrayBox(boxYZ));
-            priv_bcYZHi[i].reset(new FArrayBox(boxYZ));
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+            for (int idx = 0; idx < npts; ++idx) {
+                eval(idx);
+            }
+#endif
         }
+
+        Gpu::streamSynchronize();
+
+    }
+    else {
+
+        for (int lev = crse_level; lev <= fine_level; ++lev) {
+
+            // Create a local copy of the RHS so that we can mask it.
+
+            MultiFab source(Rhs[lev - crse_level]->boxArray(),
+                            Rhs[lev - crse_level]->DistributionMap(),
+                            1, 0);
+
+            MultiFab::Copy(source, *Rhs[lev - crse_level], 0, 0, 1, 0);
+
+            if (lev < fine_level) {
+                const MultiFab& mask = dynamic_cast<Castro*>(&(parent->getLevel(lev+1)))->build_fine_mask();
+                MultiFab::Multiply(source, mask, 0, 0, 1, 0);
+            }
+
+            const auto dx = parent->Geom(lev).CellSizeArray();
+
+#ifdef _OPENMP
+            int nthreads = omp_get_max_threads();
+            Vector<std::unique_ptr<FArrayBox> > priv_bcXYLo(nthreads);
+            Vector<std::unique_ptr<FArrayBox> > priv_bcXYHi(nthreads);
+            Vector<std::unique_ptr<FArrayBox> > priv_bcXZLo(nthreads);
+            Vector<std::unique_ptr<FArrayBox> > priv_bcXZHi(nthreads);
+            Vector<std::unique_ptr<FArrayBox> > priv_bcYZLo(nthreads);
+            Vector<std::unique_ptr<FArrayBox> > priv_bcYZHi(nthreads);
+            for (int i=0; i<nthreads; i++) {
+                priv_bcXYLo[i].reset(new FArrayBox(boxXY));
+                priv_bcXYHi[i].reset(new FArrayBox(boxXY));
+                priv_bcXZLo[i].reset(new FArrayBox(boxXZ));
+                priv_bcXZHi[i].reset(new FArrayBox(boxXZ));
+                priv_bcYZLo[i].reset(new FArrayBox(boxYZ));
+                priv_bcYZHi[i].reset(new FArrayBox(boxYZ));
+            }
 #pragma omp parallel
 #endif
-        {
+            {
 #ifdef _OPENMP
-            int tid = omp_get_thread_num();
-            priv_bcXYLo[tid]->setVal<RunOn::Gpu>(0.0);
-            priv_bcXYHi[tid]->setVal<RunOn::Gpu>(0.0);
-            priv_bcXZLo[tid]->setVal<RunOn::Gpu>(0.0);
-            priv_bcXZHi[tid]->setVal<RunOn::Gpu>(0.0);
-            priv_bcYZLo[tid]->setVal<RunOn::Gpu>(0.0);
-            priv_bcYZHi[tid]->setVal<RunOn::Gpu>(0.0);
+                int tid = omp_get_thread_num();
+                priv_bcXYLo[tid]->setVal<RunOn::Gpu>(0.0);
+                priv_bcXYHi[tid]->setVal<RunOn::Gpu>(0.0);
+                priv_bcXZLo[tid]->setVal<RunOn::Gpu>(0.0);
+                priv_bcXZHi[tid]->setVal<RunOn::Gpu>(0.0);
+                priv_bcYZLo[tid]->setVal<RunOn::Gpu>(0.0);
+                priv_bcYZHi[tid]->setVal<RunOn::Gpu>(0.0);
 #endif
-            for (MFIter mfi(source, TilingIfNotGPU()); mfi.isValid(); ++mfi)
-            {
-                const Box bx = mfi.tilebox();
+                for (MFIter mfi(source, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+                {
+                    const Box bx = mfi.tilebox();
 
-                const auto rho = source[mfi].array();
-                const auto vol = (*volume[lev])[mfi].array();
+                    const auto rho = source[mfi].array();
+                    const auto vol = (*volume[lev])[mfi].array();
 
-                // Determine if we need to add contributions from any symmetric boundaries.
+                    // Determine if we need to add contributions from any symmetric boundaries.
 
-                GpuArray<bool, 3> doSymmetricAddLo {false};
-                GpuArray<bool, 3> doSymmetricAddHi {false};
-                bool doSymmetricAdd {false};
+                    GpuArray<bool, 3> doSymmetricAddLo {false};
+                    GpuArray<bool, 3> doSymmetricAddHi {false};
+                    bool doSymmetricAdd {false};
 
-                for (int b = 0; b < 3; ++b) {
-                    if (physbc_lo[b] == amrex::PhysBCType::symmetry) {
-                        doSymmetricAddLo[b] = true;
-                        doSymmetricAdd      = true;
-                    }
+                    for (int b = 0; b < 3; ++b) {
+                        if (physbc_lo[b] == amrex::PhysBCType::symmetry) {
+                            doSymmetricAddLo[b] = true;
+                            doSymmetricAdd      = true;
+                        }
 
-                    if (physbc_hi[b] == amrex::PhysBCType::symmetry) {
-                        doSymmetricAddHi[b] = true;
-                        doSymmetricAdd      = true;
+                        if (physbc_hi[b] == amrex::PhysBCType::symmetry) {
+                            doSymmetricAddHi[b] = true;
+                            doSymmetricAdd      = true;
+                        }
                     }
-                }
 
 #ifdef _OPENMP
-                auto bcXYLo_arr = priv_bcXYLo[tid]->array();
-                auto bcXYHi_arr = priv_bcXYHi[tid]->array();
-                auto bcXZLo_arr = priv_bcXZLo[tid]->array();
-                auto bcXZHi_arr = priv_bcXZHi[tid]->array();
-                auto bcYZLo_arr = priv_bcYZLo[tid]->array();
-                auto bcYZHi_arr = priv_bcYZHi[tid]->array();
+                    auto bcXYLo_arr = priv_bcXYLo[tid]->array();
+                    auto bcXYHi_arr = priv_bcXYHi[tid]->array();
+                    auto bcXZLo_arr = priv_bcXZLo[tid]->array();
+                    auto bcXZHi_arr = priv_bcXZHi[tid]->array();
+                    auto bcYZLo_arr = priv_bcYZLo[tid]->array();
+                    auto bcYZHi_arr = priv_bcYZHi[tid]->array();
 #else
-                auto bcXYLo_arr = bcXYLo.array();
-                auto bcXYHi_arr = bcXYHi.array();
-                auto bcXZLo_arr = bcXZLo.array();
-                auto bcXZHi_arr = bcXZHi.array();
-                auto bcYZLo_arr = bcYZLo.array();
-                auto bcYZHi_arr = bcYZHi.array();
+                    auto bcXYLo_arr = bcXYLo.array();
+                    auto bcXYHi_arr = bcXYHi.array();
+                    auto bcXZLo_arr = bcXZLo.array();
+                    auto bcXZHi_arr = bcXZHi.array();
+                    auto bcYZLo_arr = bcYZLo.array();
+                    auto bcYZHi_arr = bcYZHi.array();
 #endif
 
-                amrex::ParallelFor(bx,
-                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-                {
-                    GpuArray<Real, 3> loc, locb;
-                    loc[0] = problo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0];
+                    amrex::ParallelFor(bx,
+                    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                    {
+                        GpuArray<Real, 3> loc, locb;
+                        loc[0] = problo[0] + (static_cast<Real>(i) + 0.5_rt) * dx[0];
 
 #if AMREX_SPACEDIM >= 2
-                    loc[1] = problo[1] + (static_cast<Real>(j) + 0.5_rt) * dx[1];
+                        loc[1] = problo[1] + (static_cast<Real>(j) + 0.5_rt) * dx[1];
 #else
-                    loc[1] = 0.0_rt;
+                        loc[1] = 0.0_rt;
 #endif
 
 #if AMREX_SPACEDIM == 3
-                    loc[2] = problo[2] + (static_cast<Real>(k) + 0.5_rt) * dx[2];
+                        loc[2] = problo[2] + (static_cast<Real>(k) + 0.5_rt) * dx[2];
 #else
-                    loc[2] = 0.0_rt;
+                        loc[2] = 0.0_rt;
 #endif
 
-                    // Do xy interfaces first. Note that the boundary conditions
-                    // on phi are expected to live directly on the interface.
-                    // We also have to handle the domain corners correctly. We are
-                    // assuming that bc_lo = domlo - 1 and bc_hi = domhi + 1, where
-                    // domlo and domhi are the coarse domain extent.
+                        // Do xy interfaces first. Note that the boundary conditions
+                        // on phi are expected to live directly on the interface.
+                        // We also have to handle the domain corners correctly. We are
+                        // assuming that bc_lo = domlo - 1 and bc_hi = domhi + 1, where
+                        // domlo and domhi are the coarse domain extent.
 
-                    for (int m = bc_lo[1]; m <= bc_hi[1]; ++m) {
-                        if (m == bc_lo[1]) {
-                            locb[1] = problo[1];
-                        }
-                        else if (m == bc_hi[1]) {
-                            locb[1] = probhi[1];
-                        }
-                        else {
-                            locb[1] = problo[1] + (static_cast<Real>(m) + 0.5_rt) * bc_dx[1];
-                        }
-                        Real dy2 = (loc[1] - locb[1]) * (loc[1] - locb[1]);
-
-                        for (int l = bc_lo[0]; l <= bc_hi[0]; ++l) {
-                            if (l == bc_lo[0]) {
-                                locb[0] = problo[0];
+                        for (int m = bc_lo[1]; m <= bc_hi[1]; ++m) {
+                            if (m == bc_lo[1]) {
+                                locb[1] = problo[1];
                             }
-                            else if (l == bc_hi[0]) {
-                                locb[0] = probhi[1];
+                            else if (m == bc_hi[1]) {
+                                locb[1] = probhi[1];
                             }
                             else {
-                                locb[0] = problo[0] + (static_cast<Real>(l) + 0.5_rt) * bc_dx[0];
+                                locb[1] = problo[1] + (static_cast<Real>(m) + 0.5_rt) * bc_dx[1];
                             }
-                            Real dx2 = (loc[0] - locb[0]) * (loc[0] - locb[0]);
-
-                            locb[2] = problo[2];
-                            Real dz2 = (loc[2] - locb[2]) * (loc[2] - locb[2]);
+                            Real dy2 = (loc[1] - locb[1]) * (loc[1] - locb[1]);
 
-                            Real r = std::sqrt(dx2 + dy2 + dz2);
+                            for (int l = bc_lo[0]; l <= bc_hi[0]; ++l) {
+                                if (l == bc_lo[0]) {
+                                    locb[0] = problo[0];
+                                }
+                                else if (l == bc_hi[0]) {
+                                    locb[0] = probhi[0];
+                                }
+                                else {
+                                    locb[0] = problo[0] + (static_cast<Real>(l) + 0.5_rt) * bc_dx[0];
+                                }
+                                Real dx2 = (loc[0] - locb[0]) * (loc[0] - locb[0]);
 
-                            Real dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
+                                locb[2] = problo[2];
+                                Real dz2 = (loc[2] - locb[2]) * (loc[2] - locb[2]);
 
-                            // Now, add any contributions from mass that is hidden behind
-                            // a symmetric boundary.
+                                Real r = std::sqrt(dx2 + dy2 + dz2);
 
-                            if (doSymmetricAdd) {
+                                Real dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
 
-                                dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
-                                                                rho(i,j,k), vol(i,j,k),
-                                                                doSymmetricAddLo, doSymmetricAddHi);
+                                // Now, add any contributions from mass that is hidden behind
+                                // a symmetric boundary.
 
-                            }
+                                if (doSymmetricAdd) {
 
-                            Gpu::Atomic::Add(&bcXYLo_arr(l,m,0), dbc);
+                                    dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
+                                                                    rho(i,j,k), vol(i,j,k),
+                                                                    doSymmetricAddLo, doSymmetricAddHi);
 
-                            locb[2] = probhi[2];
-                            dz2 = (loc[2] - locb[2]) * (loc[2] - locb[2]);
+                                }
 
-                            r = std::sqrt(dx2 + dy2 + dz2);
+                                Gpu::Atomic::Add(&bcXYLo_arr(l,m,0), dbc);
 
-                            dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
+                                locb[2] = probhi[2];
+                                dz2 = (loc[2] - locb[2]) * (loc[2] - locb[2]);
 
-                            if (doSymmetricAdd) {
+                                r = std::sqrt(dx2 + dy2 + dz2);
 
-                                dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
-                                                                rho(i,j,k), vol(i,j,k),
-                                                                doSymmetricAddLo, doSymmetricAddHi);
+                                dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
 
-                            }
+                                if (doSymmetricAdd) {
 
-                            Gpu::Atomic::Add(&bcXYHi_arr(l,m,0), dbc);
+                                    dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
+                                                                    rho(i,j,k), vol(i,j,k),
+                                                                    doSymmetricAddLo, doSymmetricAddHi);
 
-                        }
+                                }
 
-                    }
+                                Gpu::Atomic::Add(&bcXYHi_arr(l,m,0), dbc);
 
-                    // Now do xz interfaces.
+                            }
 
-                    for (int n = bc_lo[2]; n <= bc_hi[2]; ++n) {
-                        if (n == bc_lo[2]) {
-                            locb[2] = problo[2];
-                        }
-                        else if (n == bc_hi[2]) {
-                            locb[2] = probhi[2];
                         }
-                        else {
-                            locb[2] = problo[2] + (static_cast<Real>(n) + 0.5_rt) * bc_dx[2];
-                        }
-                        Real dz2 = (loc[2] - locb[2]) * (loc[2] - locb[2]);
 
-                        for (int l = bc_lo[0]; l <= bc_hi[0]; ++l) {
-                            if (l == bc_lo[0]) {
-                                locb[0] = problo[0];
+                        // Now do xz interfaces.
+
+                        for (int n = bc_lo[2]; n <= bc_hi[2]; ++n) {
+                            if (n == bc_lo[2]) {
+                                locb[2] = problo[2];
                             }
-                            else if (l == bc_hi[0]) {
-                                locb[0] = probhi[0];
+                            else if (n == bc_hi[2]) {
+                                locb[2] = probhi[2];
                             }
                             else {
-                                locb[0] = problo[0] + (static_cast<Real>(l) + 0.5_rt) * bc_dx[0];
+                                locb[2] = problo[2] + (static_cast<Real>(n) + 0.5_rt) * bc_dx[2];
                             }
-                            Real dx2 = (loc[0] - locb[0]) * (loc[0] - locb[0]);
-
-                            locb[1] = problo[1];
-                            Real dy2 = (loc[1] - locb[1]) * (loc[1] - locb[1]);
+                            Real dz2 = (loc[2] - locb[2]) * (loc[2] - locb[2]);
 
-                            Real r = std::sqrt(dx2 + dy2 + dz2);
+                            for (int l = bc_lo[0]; l <= bc_hi[0]; ++l) {
+                                if (l == bc_lo[0]) {
+                                    locb[0] = problo[0];
+                                }
+                                else if (l == bc_hi[0]) {
+                                    locb[0] = probhi[0];
+                                }
+                                else {
+                                    locb[0] = problo[0] + (static_cast<Real>(l) + 0.5_rt) * bc_dx[0];
+                                }
+                                Real dx2 = (loc[0] - locb[0]) * (loc[0] - locb[0]);
 
-                            Real dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
+                                locb[1] = problo[1];
+                                Real dy2 = (loc[1] - locb[1]) * (loc[1] - locb[1]);
 
-                            if (doSymmetricAdd) {
+                                Real r = std::sqrt(dx2 + dy2 + dz2);
 
-                                dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
-                                                                rho(i,j,k), vol(i,j,k),
-                                                                doSymmetricAddLo, doSymmetricAddHi);
+                                Real dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
 
-                            }
+                                if (doSymmetricAdd) {
 
-                            Gpu::Atomic::Add(&bcXZLo_arr(l,0,n), dbc);
+                                    dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
+                                                                    rho(i,j,k), vol(i,j,k),
+                                                                    doSymmetricAddLo, doSymmetricAddHi);
 
-                            locb[1] = probhi[1];
-                            dy2 = (loc[1] - locb[1]) * (loc[1] - locb[1]);
+                                }
 
-                            r = std::sqrt(dx2 + dy2 + dz2);
+                                Gpu::Atomic::Add(&bcXZLo_arr(l,0,n), dbc);
 
-                            dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
+                                locb[1] = probhi[1];
+                                dy2 = (loc[1] - locb[1]) * (loc[1] - locb[1]);
 
-                            if (doSymmetricAdd) {
+                                r = std::sqrt(dx2 + dy2 + dz2);
 
-                                dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
-                                                                rho(i,j,k), vol(i,j,k),
-                                                                doSymmetricAddLo, doSymmetricAddHi);
+                                dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
 
-                            }
+                                if (doSymmetricAdd) {
 
-                            Gpu::Atomic::Add(&bcXZHi_arr(l,0,n), dbc);
+                                    dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
+                                                                    rho(i,j,k), vol(i,j,k),
+                                                                    doSymmetricAddLo, doSymmetricAddHi);
 
-                        }
+                                }
 
-                    }
+                                Gpu::Atomic::Add(&bcXZHi_arr(l,0,n), dbc);
 
-                    // Finally, do yz interfaces.
+                            }
 
-                    for (int n = bc_lo[2]; n <= bc_hi[2]; ++n) {
-                        if (n == bc_lo[2]) {
-                            locb[2] = problo[2];
-                        }
-                        else if (n == bc_hi[2]) {
-                            locb[2] = probhi[2];
                         }
-                        else {
-                            locb[2] = problo[2] + (static_cast<Real>(n) + 0.5_rt) * bc_dx[2];
-                        }
-                        Real dz2 = (loc[2] - locb[2]) * (loc[2] - locb[2]);
 
-                        for (int m = bc_lo[1]; m <= bc_hi[1]; ++m) {
-                            if (m == bc_lo[1]) {
-                                locb[1] = problo[1];
+                        // Finally, do yz interfaces.
+
+                        for (int n = bc_lo[2]; n <= bc_hi[2]; ++n) {
+                            if (n == bc_lo[2]) {
+                                locb[2] = problo[2];
                             }
-                            else if (m == bc_hi[1]) {
-                                locb[1] = probhi[1];
+                            else if (n == bc_hi[2]) {
+                                locb[2] = probhi[2];
                             }
                             else {
-                                locb[1] = problo[1] + (static_cast<Real>(m) + 0.5_rt) * bc_dx[1];
+                                locb[2] = problo[2] + (static_cast<Real>(n) + 0.5_rt) * bc_dx[2];
                             }
-                            Real dy2 = (loc[1] - locb[1]) * (loc[1] - locb[1]);
+                            Real dz2 = (loc[2] - locb[2]) * (loc[2] - locb[2]);
 
-                            locb[0] = problo[0];
-                            Real dx2 = (loc[0] - locb[0]) * (loc[0] - locb[0]);
+                            for (int m = bc_lo[1]; m <= bc_hi[1]; ++m) {
+                                if (m == bc_lo[1]) {
+                                    locb[1] = problo[1];
+                                }
+                                else if (m == bc_hi[1]) {
+                                    locb[1] = probhi[1];
+                                }
+                                else {
+                                    locb[1] = problo[1] + (static_cast<Real>(m) + 0.5_rt) * bc_dx[1];
+                                }
+                                Real dy2 = (loc[1] - locb[1]) * (loc[1] - locb[1]);
 
-                            Real r = std::sqrt(dx2 + dy2 + dz2);
+                                locb[0] = problo[0];
+                                Real dx2 = (loc[0] - locb[0]) * (loc[0] - locb[0]);
 
-                            Real dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
+                                Real r = std::sqrt(dx2 + dy2 + dz2);
 
-                            if (doSymmetricAdd) {
+                                Real dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
 
-                                dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
-                                                                rho(i,j,k), vol(i,j,k),
-                                                                doSymmetricAddLo, doSymmetricAddHi);
+                                if (doSymmetricAdd) {
 
-                            }
+                                    dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
+                                                                    rho(i,j,k), vol(i,j,k),
+                                                                    doSymmetricAddLo, doSymmetricAddHi);
 
-                            Gpu::Atomic::Add(&bcYZLo_arr(0,m,n), dbc);
+                                }
 
-                            locb[0] = probhi[0];
-                            dx2 = (loc[0] - locb[0]) * (loc[0] - locb[0]);
+                                Gpu::Atomic::Add(&bcYZLo_arr(0,m,n), dbc);
 
-                            r = std::sqrt(dx2 + dy2 + dz2);
+                                locb[0] = probhi[0];
+                                dx2 = (loc[0] - locb[0]) * (loc[0] - locb[0]);
 
-                            dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
+                                r = std::sqrt(dx2 + dy2 + dz2);
 
-                            if (doSymmetricAdd) {
+                                dbc = -C::Gconst * rho(i,j,k) * vol(i,j,k) / r;
 
-                                dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
-                                                                rho(i,j,k), vol(i,j,k),
-                                                                doSymmetricAddLo, doSymmetricAddHi);
+                                if (doSymmetricAdd) {
 
-                            }
+                                    dbc += direct_sum_symmetric_add(loc, locb, problo, probhi,
+                                                                    rho(i,j,k), vol(i,j,k),
+                                                                    doSymmetricAddLo, doSymmetricAddHi);
 
-                            Gpu::Atomic::Add(&bcYZHi_arr(0,m,n), dbc);
+                                }
 
-                        }
+                                Gpu::Atomic::Add(&bcYZHi_arr(0,m,n), dbc);
 
-                    }
+                            }
 
-                });
+                        }
 
-            }
+                    });
+
+                }
 
 #ifdef _OPENMP
-            Real* pXYLo = bcXYLo.dataPtr();
-            Real* pXYHi = bcXYHi.dataPtr();
-            Real* pXZLo = bcXZLo.dataPtr();
-            Real* pXZHi = bcXZHi.dataPtr();
-            Real* pYZLo = bcYZLo.dataPtr();
-            Real* pYZHi = bcYZHi.dataPtr();
+                Real* pXYLo = bcXYLo.dataPtr();
+                Real* pXYHi = bcXYHi.dataPtr();
+                Real* pXZLo = bcXZLo.dataPtr();
+                Real* pXZHi = bcXZHi.dataPtr();
+                Real* pYZLo = bcYZLo.dataPtr();
+                Real* pYZHi = bcYZHi.dataPtr();
 #pragma omp barrier
 #pragma omp for nowait
-            for (int i=0; i<nPtsXY; i++) {
-                for (int it=0; it<nthreads; it++) {
-                    const Real* pl = priv_bcXYLo[it]->dataPtr();
-                    const Real* ph = priv_bcXYHi[it]->dataPtr();
-                    pXYLo[i] += pl[i];
-                    pXYHi[i] += ph[i];
+                for (int i=0; i<nPtsXY; i++) {
+                    for (int it=0; it<nthreads; it++) {
+                        const Real* pl = priv_bcXYLo[it]->dataPtr();
+                        const Real* ph = priv_bcXYHi[it]->dataPtr();
+                        pXYLo[i] += pl[i];
+                        pXYHi[i] += ph[i];
+                    }
                 }
-            }
 #pragma omp for nowait
-            for (int i=0; i<nPtsXZ; i++) {
-                for (int it=0; it<nthreads; it++) {
-                    const Real* pl = priv_bcXZLo[it]->dataPtr();
-                    const Real* ph = priv_bcXZHi[it]->dataPtr();
-                    pXZLo[i] += pl[i];
-                    pXZHi[i] += ph[i];
+                for (int i=0; i<nPtsXZ; i++) {
+                    for (int it=0; it<nthreads; it++) {
+                        const Real* pl = priv_bcXZLo[it]->dataPtr();
+                        const Real* ph = priv_bcXZHi[it]->dataPtr();
+                        pXZLo[i] += pl[i];
+                        pXZHi[i] += ph[i];
+                    }
                 }
-            }
 #pragma omp for nowait
-            for (int i=0; i<nPtsYZ; i++) {
-                for (int it=0; it<nthreads; it++) {
-                    const Real* pl = priv_bcYZLo[it]->dataPtr();
-                    const Real* ph = priv_bcYZHi[it]->dataPtr();
-                    pYZLo[i] += pl[i];
-                    pYZHi[i] += ph[i];
+                for (int i=0; i<nPtsYZ; i++) {
+                    for (int it=0; it<nthreads; it++) {
+                        const Real* pl = priv_bcYZLo[it]->dataPtr();
+                        const Real* ph = priv_bcYZHi[it]->dataPtr();
+                        pYZLo[i] += pl[i];
+                        pYZHi[i] += ph[i];
+                    }
                 }
-            }
 #endif
-        }
+            }
 
-    } // end loop over levels
+        } // end loop over levels
+
+    }
 
     // because the number of elements in mpi_reduce is int
     BL_ASSERT(nPtsXY <= std::numeric_limits<int>::max());
@@ -3062,37 +3645,33 @@ Gravity::make_radial_gravity(int level, Real time, RealVector& radial_grav)
         const Real t_new = LevelData[lev]->get_state_data(State_Type).curTime();
         const Real eps   = (t_new - t_old) * 1.e-6;
 
-        // Create MultiFab with NUM_STATE components and no ghost cells
-        MultiFab S(grids[lev],dmap[lev],NUM_STATE,0);
+        // Rather than making a time-interpolated copy of the state, we
+        // pass both the old and new state to compute_radial_mass and
+        // interpolate only the components it needs as we bin them.
+
+        const MultiFab& S_old = LevelData[lev]->get_old_data(State_Type);
+        const MultiFab& S_new = LevelData[lev]->get_new_data(State_Type);
+
+        Real alpha;
 
         if ( eps == 0.0 ) {  // NOLINT(bugprone-branch-clone,-warnings-as-errors)
             // Old and new time are identical; this should only happen if
             // dt is smaller than roundoff compared to the current time,
             // in which case we're probably in trouble anyway,
             // but we will still handle it gracefully here.
-            MultiFab::Copy(S, LevelData[lev]->get_new_data(State_Type), 0, 0, NUM_STATE, 0);
+            alpha = 1.0;
         }
         else if ( std::abs(time-t_old) < eps)
         {
-            MultiFab::Copy(S, LevelData[lev]->get_old_data(State_Type), 0, 0, NUM_STATE, 0);
+            alpha = 0.0;
         }
         else if ( std::abs(time-t_new) < eps)
         {
-            MultiFab::Copy(S, LevelData[lev]->get_new_data(State_Type), 0, 0, NUM_STATE, 0);
+            alpha = 1.0;
         }
         else if (time > t_old && time < t_new)
         {
-            Real alpha   = (time - t_old)/(t_new - t_old);
-            Real omalpha = 1.0 - alpha;
-
-            MultiFab::Copy(S, LevelData[lev]->get_old_data(State_Type), 0, 0, NUM_STATE, 0);
-            S.mult(omalpha);
-
-            MultiFab S_new(grids[lev],dmap[lev],NUM_STATE,0);
-            MultiFab::Copy(S_new, LevelData[lev]->get_new_data(State_Type), 0, 0, NUM_STATE, 0);
-            S_new.mult(alpha);
-
-            S.plus(S_new,0,NUM_STATE,0);
+            alpha = (time - t_old)/(t_new - t_old);
         }
         else
         {
@@ -3101,15 +3680,16 @@ Gravity::make_radial_gravity(int level, Real time, RealVector& radial_grav)
             amrex::Abort("Problem in Gravity::make_radial_gravity");
         }
 
-        if (lev < level)
+        MultiFab tmp_mf;
+        const MultiFab* mask = &tmp_mf;
+        const bool mask_available = lev < level;
+
+        if (mask_available)
         {
             auto* fine_level = dynamic_cast<Castro*>(&(parent->getLevel(lev+1)));
-        if (fine_level != nullptr) {
-        const MultiFab& mask = fine_level->build_fine_mask();
-        for (int n = 0; n < NUM_STATE; ++n) {
-            MultiFab::Multiply(S, mask, 0, n, 1, 0);
-        }
-        } else {
+            if (fine_level != nullptr) {
+                mask = &(fine_level->build_fine_mask());
+            } else {
                 amrex::Abort("unable to create mask");
             }
         }
@@ -3152,13 +3732,15 @@ Gravity::make_radial_gravity(int level, Real time, RealVector& radial_grav)
 #ifdef _OPENMP
             int tid = omp_get_thread_num();
 #endif
-            for (MFIter mfi(S, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+            for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi)
             {
                 const Box& bx = mfi.tilebox();
-                FArrayBox& fab = S[mfi];
 
                 compute_radial_mass(bx,
-                                    fab.array(),
+                                    S_old.const_array(mfi),
+                                    S_new.const_array(mfi),
+                                    alpha,
+                                    mask_available ? mask->const_array(mfi) : Array4<Real const>{},
 #ifdef _OPENMP
                                     priv_radial_mass[tid],
                                     priv_radial_vol[tid],
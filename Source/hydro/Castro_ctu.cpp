@@ -1,6 +1,8 @@
 #include <Castro.H>
 #include <Castro_util.H>
 
+#include <AMReX_OpenMP.H>
+
 #ifdef RADIATION
 #include <Radiation.H>
 #endif
@@ -383,3 +385,43 @@ Castro::add_sdc_source_to_states(const Box& bx, const int idir, const Real dt,
     });
 
 }
+
+void
+Castro::init_hydro_scratch_arenas()
+{
+#ifndef AMREX_USE_GPU
+    if (castro::hydro_scratch_arena) {
+        // one arena per thread; these persist for the lifetime of this
+        // level, so they are recreated when the level changes in a regrid
+        const int nthreads = OpenMP::get_max_threads();
+        if (hydro_scratch.size() != static_cast<std::size_t>(nthreads)) {
+            hydro_scratch.clear();
+            hydro_scratch.resize(nthreads);
+        }
+    }
+#endif
+}
+
+Arena*
+Castro::get_hydro_scratch_arena(Arena* fallback)
+{
+#ifndef AMREX_USE_GPU
+    if (castro::hydro_scratch_arena) {
+        auto& arena = hydro_scratch[OpenMP::get_thread_num()];
+
+        // allocate this from the thread that uses it, so the buffer is
+        // first touched (and placed in memory) by that thread
+        if (arena == nullptr) {
+            arena = std::make_unique<ScratchArena>();
+        }
+
+        // the Fabs from the previous hydro update have gone out of
+        // scope, so all of the memory can be recycled
+        arena->reset();
+
+        return arena.get();
+    }
+#endif
+
+    return fallback;
+}
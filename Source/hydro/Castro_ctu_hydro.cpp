@@ -125,6 +125,15 @@ Castro::construct_ctu_hydro_source(Real time, Real dt)  // NOLINT(readability-co
    }
 #endif
 
+  // On CPUs this may be a candidate tile size that we are timing
+  // (see castro.hydro_tile_size_autotune).
+
+  const IntVect tile_size = get_hydro_tile_size();
+
+  init_hydro_scratch_arenas();
+
+  const Real tile_strt_time = ParallelDescriptor::second();
+
 #ifdef _OPENMP
 #ifdef RADIATION
 #pragma omp parallel reduction(max:nstep_fsp)
@@ -140,57 +149,62 @@ Castro::construct_ctu_hydro_source(Real time, Real dt)  // NOLINT(readability-co
 
     // Declare local storage now. This should be done outside the
     // MFIter loop, and then we will resize the Fabs in each MFIter
-    // loop iteration. We use the async arenato ensure that their
+    // loop iteration. We use the async arena to ensure that their
     // memory is saved until it is no longer needed (only relevant for
-    // the asynchronous case, usually on GPUs).
-
-    FArrayBox shk(The_Async_Arena());
-    FArrayBox q(The_Async_Arena()), qaux(The_Async_Arena());
-    FArrayBox rho_inv(The_Async_Arena());
-    FArrayBox src_q(The_Async_Arena());
-    FArrayBox qxm(The_Async_Arena()), qxp(The_Async_Arena());
+    // the asynchronous case, usually on GPUs).  With
+    // castro.hydro_scratch_arena (CPUs only), the memory instead comes
+    // from a persistent per-thread arena that is recycled for each
+    // hydro update, so there are no allocations after the first one.
+
+    Arena* scratch = get_hydro_scratch_arena();
+
+    FArrayBox shk(scratch);
+    FArrayBox q(scratch), qaux(scratch);
+    FArrayBox rho_inv(scratch);
+    FArrayBox src_q(scratch);
+    FArrayBox qxm(scratch), qxp(scratch);
 #if AMREX_SPACEDIM >= 2
-    FArrayBox qym(The_Async_Arena()), qyp(The_Async_Arena());
+    FArrayBox qym(scratch), qyp(scratch);
 #endif
 #if AMREX_SPACEDIM == 3
-    FArrayBox qzm(The_Async_Arena()), qzp(The_Async_Arena());
+    FArrayBox qzm(scratch), qzp(scratch);
 #endif
-    FArrayBox div(The_Async_Arena());
+    FArrayBox div(scratch);
 #if AMREX_SPACEDIM >= 2
-    FArrayBox ftmp1(The_Async_Arena()), ftmp2(The_Async_Arena());
+    FArrayBox ftmp1(scratch), ftmp2(scratch);
 #ifdef RADIATION
-    FArrayBox rftmp1(The_Async_Arena()), rftmp2(The_Async_Arena());
+    FArrayBox rftmp1(scratch), rftmp2(scratch);
 #endif
-    FArrayBox qgdnvtmp1(The_Async_Arena()), qgdnvtmp2(The_Async_Arena());
-    FArrayBox ql(The_Async_Arena()), qr(The_Async_Arena());
+    FArrayBox qgdnvtmp1(scratch), qgdnvtmp2(scratch);
+    FArrayBox ql(scratch), qr(scratch);
 #endif
     Vector<FArrayBox> flux, qe;
     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
-        flux.push_back(FArrayBox(The_Async_Arena()));
-        qe.push_back(FArrayBox(The_Async_Arena()));
+        flux.push_back(FArrayBox(scratch));
+        qe.push_back(FArrayBox(scratch));
     }
 
 #ifdef RADIATION
     Vector<FArrayBox> rad_flux;
     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
-        rad_flux.push_back(FArrayBox(The_Async_Arena()));
+        rad_flux.push_back(FArrayBox(scratch));
     }
 #endif
 #if AMREX_SPACEDIM <= 2
-    FArrayBox pradial(The_Async_Arena());
+    FArrayBox pradial(scratch);
 #endif
 #if AMREX_SPACEDIM == 3
-    FArrayBox qmyx(The_Async_Arena()), qpyx(The_Async_Arena());
-    FArrayBox qmzx(The_Async_Arena()), qpzx(The_Async_Arena());
-    FArrayBox qmxy(The_Async_Arena()), qpxy(The_Async_Arena());
-    FArrayBox qmzy(The_Async_Arena()), qpzy(The_Async_Arena());
-    FArrayBox qmxz(The_Async_Arena()), qpxz(The_Async_Arena());
-    FArrayBox qmyz(The_Async_Arena()), qpyz(The_Async_Arena());
+    FArrayBox qmyx(scratch), qpyx(scratch);
+    FArrayBox qmzx(scratch), qpzx(scratch);
+    FArrayBox qmxy(scratch), qpxy(scratch);
+    FArrayBox qmzy(scratch), qpzy(scratch);
+    FArrayBox qmxz(scratch), qpxz(scratch);
+    FArrayBox qmyz(scratch), qpyz(scratch);
 #endif
 
     MultiFab& old_source = get_old_data(Source_Type);
 
-    for (MFIter mfi(S_new, hydro_tile_size); mfi.isValid(); ++mfi) {
+    for (MFIter mfi(S_new, tile_size); mfi.isValid(); ++mfi) {
 
       // the valid region box
       const Box& bx = mfi.tilebox();
@@ -1418,6 +1432,8 @@ Castro::construct_ctu_hydro_source(Real time, Real dt)  // NOLINT(readability-co
 
   } // OMP loop
 
+  record_hydro_tile_size_timing(ParallelDescriptor::second() - tile_strt_time);
+
 #ifdef RADIATION
   if (radiation->verbose>=1) {
       amrex::Real llevel = level;
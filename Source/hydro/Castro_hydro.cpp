@@ -1,5 +1,7 @@
 #include <Castro.H>
 
+#include <algorithm>
+
 #ifdef RADIATION
 #include <Radiation.H>
 #endif
@@ -350,3 +352,204 @@ Castro::check_for_cfl_violation(const MultiFab& State, const Real dt)
         amrex::Abort("CFL is too high at this level; go back to a checkpoint and restart with lower CFL number");
     }
 }
+
+Long
+Castro::hydro_tile_footprint(const IntVect& tile)
+{
+    // This mirrors the temporaries allocated in each MFIter iteration
+    // of construct_ctu_hydro_source.  It does not need to be exact,
+    // it is only used to rank candidate tile sizes.
+
+    const Box bx(IntVect(0), tile - 1);
+    const Box obx = amrex::grow(bx, 1);
+
+    Long ncomp_zones = 0;
+
+    // q and qaux
+
+#ifdef RADIATION
+    ncomp_zones += amrex::grow(bx, NUM_GROW).numPts() * (NQ + NQAUX);
+#else
+    ncomp_zones += amrex::grow(bx, NUM_GROW).numPts() * (NQTHERM + NQAUX);
+#endif
+
+    // rho_inv and src_q
+
+    ncomp_zones += amrex::grow(bx, 3).numPts() * (1 + NQSRC);
+
+    // shk, div, and the normal interface states
+
+    ncomp_zones += obx.numPts() * (2 + 2 * AMREX_SPACEDIM * NQ);
+
+    // flux and qe
+
+    for (int idir = 0; idir < AMREX_SPACEDIM; ++idir) {
+        ncomp_zones += amrex::grow(amrex::surroundingNodes(bx, idir), 1).numPts() * (NUM_STATE + NGDNV);
+    }
+
+#if AMREX_SPACEDIM >= 2
+    // ftmp1, ftmp2, qgdnvtmp1, qgdnvtmp2, ql, qr
+
+    ncomp_zones += obx.numPts() * (2 * NUM_STATE + 2 * NGDNV + 2 * NQ);
+#endif
+
+#if AMREX_SPACEDIM == 3
+    // the transverse-corrected states qmyx, qpyx, ..., qmyz, qpyz
+
+    ncomp_zones += obx.numPts() * (12 * NQ);
+#endif
+
+    return ncomp_zones * static_cast<Long>(sizeof(Real));
+}
+
+IntVect
+Castro::get_hydro_tile_size()
+{
+#ifndef AMREX_USE_GPU
+    if (castro::hydro_tile_size_autotune) {
+
+        if (hydro_tile_size_candidate >= 0) {
+            // we are still timing the candidates
+            return hydro_tile_size_candidates[hydro_tile_size_candidate];
+        }
+
+        if (!hydro_tile_size_candidates.empty()) {
+            // we are done tuning
+            return tuned_hydro_tile_size;
+        }
+
+        // Build the list of candidates.  A tile can never be larger
+        // than the largest box on this level, so clip to that to
+        // avoid timing the same effective tile more than once.
+
+        IntVect max_box_size{1};
+        for (int i = 0; i < grids.size(); ++i) {
+            max_box_size.max(grids[i].length());
+        }
+
+        const Vector<int> x_sizes = {1024, 64, 32, 16};
+#if AMREX_SPACEDIM >= 2
+        const Vector<int> y_sizes = {32, 16, 8, 4};
+#else
+        const Vector<int> y_sizes = {1};
+#endif
+#if AMREX_SPACEDIM == 3
+        const Vector<int> z_sizes = {32, 16, 8, 4};
+#else
+        const Vector<int> z_sizes = {1};
+#endif
+
+        Vector<std::pair<Long, IntVect>> shapes;
+
+        for (int nx : x_sizes) {
+            for (int ny : y_sizes) {
+                for (int nz : z_sizes) {
+                    amrex::ignore_unused(ny, nz);
+
+                    IntVect tile(AMREX_D_DECL(nx, ny, nz));
+                    tile.min(max_box_size);
+
+                    auto same_tile = [&] (const auto& s) { return s.second == tile; };
+
+                    if (std::none_of(shapes.begin(), shapes.end(), same_tile)) {
+                        shapes.emplace_back(hydro_tile_footprint(tile), tile);
+                    }
+                }
+            }
+        }
+
+        // Prefer the largest tiles whose temporaries fit in the cache
+        // budget, since these have the least ghost zone overhead.  If
+        // nothing fits, fall back to the smallest footprints.
+
+        std::sort(shapes.begin(), shapes.end(),
+                  [] (const auto& a, const auto& b) { return a.first > b.first; });
+
+        const Long budget = castro::hydro_tile_size_autotune_cache_bytes;
+        const auto max_candidates = static_cast<std::size_t>(amrex::max(castro::hydro_tile_size_autotune_max_candidates, 1));
+
+        for (const auto& s : shapes) {
+            if (s.first <= budget && hydro_tile_size_candidates.size() < max_candidates) {
+                hydro_tile_size_candidates.push_back(s.second);
+            }
+        }
+
+        for (auto it = shapes.rbegin(); it != shapes.rend(); ++it) {
+            if (hydro_tile_size_candidates.size() >= max_candidates) {
+                break;
+            }
+            if (std::find(hydro_tile_size_candidates.begin(), hydro_tile_size_candidates.end(),
+                          it->second) == hydro_tile_size_candidates.end()) {
+                hydro_tile_size_candidates.push_back(it->second);
+            }
+        }
+
+        // Always time the default tile size too, so we never do worse than it.
+
+        IntVect default_tile_size = hydro_tile_size;
+        default_tile_size.min(max_box_size);
+
+        if (std::find(hydro_tile_size_candidates.begin(), hydro_tile_size_candidates.end(),
+                      default_tile_size) == hydro_tile_size_candidates.end()) {
+            hydro_tile_size_candidates.push_back(default_tile_size);
+        }
+
+        hydro_tile_size_timings.clear();
+        hydro_tile_size_candidate = 0;
+
+        return hydro_tile_size_candidates[hydro_tile_size_candidate];
+    }
+#endif
+
+    return hydro_tile_size;
+}
+
+void
+Castro::record_hydro_tile_size_timing(Real run_time)
+{
+#ifndef AMREX_USE_GPU
+    if (!castro::hydro_tile_size_autotune || hydro_tile_size_candidate < 0) {
+        return;
+    }
+
+    // All ranks must use the same decision, so time by the slowest rank.
+
+    ParallelDescriptor::ReduceRealMax(run_time);
+
+    hydro_tile_size_timings.push_back(run_time);
+
+    // The first call on this level also pays for first-touch page
+    // faults and cache warmup, so we time the first candidate twice
+    // and discard the first measurement.
+
+    if (hydro_tile_size_timings.size() == 1) {
+        return;
+    }
+
+    hydro_tile_size_candidate++;
+
+    if (hydro_tile_size_candidate < static_cast<int>(hydro_tile_size_candidates.size())) {
+        return;
+    }
+
+    // We have timed all candidates; pick the fastest.
+
+    int best = 0;
+    for (int n = 1; n < static_cast<int>(hydro_tile_size_candidates.size()); ++n) {
+        if (hydro_tile_size_timings[n+1] < hydro_tile_size_timings[best+1]) {
+            best = n;
+        }
+    }
+
+    tuned_hydro_tile_size = hydro_tile_size_candidates[best];
+    hydro_tile_size_candidate = -1;
+
+    if (verbose) {
+        amrex::Print() << "... hydro tile size on level " << level << " tuned to "
+                       << tuned_hydro_tile_size << " (estimated footprint "
+                       << hydro_tile_footprint(tuned_hydro_tile_size) << " bytes)" << std::endl << std::endl;
+    }
+#else
+    amrex::ignore_unused(run_time);
+#endif
+}
@@ -55,6 +55,8 @@ Castro::construct_mol_hydro_source(Real time, Real dt, MultiFab& A_update)
   GeometryData geomdata = geom.data();
 #endif
 
+  init_hydro_scratch_arenas();
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -62,30 +64,34 @@ Castro::construct_mol_hydro_source(Real time, Real dt, MultiFab& A_update)
 
     // Declare local storage now. This should be done outside the
     // MFIter loop, and then we will resize the Fabs in each MFIter
-    // loop iteration. We use the async arenato ensure that their
+    // loop iteration. We use the async arena to ensure that their
     // memory is saved until it is no longer needed (only relevant for
-    // the asynchronous case, usually on GPUs).
-
-    FArrayBox flatn(The_Async_Arena());
-    FArrayBox cond(The_Async_Arena());
-    FArrayBox dq(The_Async_Arena());
-    FArrayBox src_q(The_Async_Arena());
-    FArrayBox shk(The_Async_Arena());
-    FArrayBox qm(The_Async_Arena()), qp(The_Async_Arena());
-    FArrayBox div(The_Async_Arena());
-    FArrayBox q_int(The_Async_Arena());
-    FArrayBox q_avg(The_Async_Arena());
-    FArrayBox q_fc(The_Async_Arena());
-    FArrayBox f_avg(The_Async_Arena());
+    // the asynchronous case, usually on GPUs).  With
+    // castro.hydro_scratch_arena (CPUs only), the memory instead comes
+    // from a persistent per-thread arena.
+
+    Arena* scratch = get_hydro_scratch_arena();
+
+    FArrayBox flatn(scratch);
+    FArrayBox cond(scratch);
+    FArrayBox dq(scratch);
+    FArrayBox src_q(scratch);
+    FArrayBox shk(scratch);
+    FArrayBox qm(scratch), qp(scratch);
+    FArrayBox div(scratch);
+    FArrayBox q_int(scratch);
+    FArrayBox q_avg(scratch);
+    FArrayBox q_fc(scratch);
+    FArrayBox f_avg(scratch);
     Vector<FArrayBox> flux, qe;
     for (int n = 0; n < AMREX_SPACEDIM; ++n) {
-        flux.push_back(FArrayBox(The_Async_Arena()));
-        qe.push_back(FArrayBox(The_Async_Arena()));
+        flux.push_back(FArrayBox(scratch));
+        qe.push_back(FArrayBox(scratch));
     }
 #if AMREX_SPACEDIM <= 2
-    FArrayBox pradial(The_Async_Arena());
+    FArrayBox pradial(scratch);
 #endif
-    FArrayBox avis(The_Async_Arena());
+    FArrayBox avis(scratch);
 
     MultiFab& old_source = get_old_data(Source_Type);
 
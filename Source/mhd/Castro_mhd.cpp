@@ -36,52 +36,66 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
       //}
 
 
-      BL_ASSERT(NUM_GROW == 6);
+      // the number of ghost zones of the old state that we use.  With
+      // flattening this is the full 6, otherwise the reconstruction
+      // on bxi below only reaches 5 zones out
 
+      const int ng = Sborder.nGrow();
+
+      AMREX_ASSERT(ng == hydro_ngrow());
+      AMREX_ASSERT(Bx_old_tmp.nGrow() >= ng);
+
+      init_hydro_scratch_arenas();
 
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
 
-      FArrayBox flux[AMREX_SPACEDIM], E[AMREX_SPACEDIM];
+      // With castro.hydro_scratch_arena (CPUs only), the temporaries
+      // come from a persistent per-thread arena.
+
+      Arena* scratch = get_hydro_scratch_arena(The_Arena());
 
-      FArrayBox q;
-      FArrayBox qaux;
-      FArrayBox srcQ;
+      FArrayBox flux[AMREX_SPACEDIM] = {FArrayBox(scratch), FArrayBox(scratch), FArrayBox(scratch)};
+      FArrayBox E[AMREX_SPACEDIM] = {FArrayBox(scratch), FArrayBox(scratch), FArrayBox(scratch)};
 
-      FArrayBox flatn;
-      FArrayBox flatg;
+      FArrayBox q(scratch);
+      FArrayBox qaux(scratch);
+      FArrayBox srcQ(scratch);
 
-      FArrayBox qleft[AMREX_SPACEDIM];
-      FArrayBox qright[AMREX_SPACEDIM];
+      FArrayBox flatn(scratch);
+      FArrayBox flatg(scratch);
 
-      FArrayBox flxx1D;
-      FArrayBox flxy1D;
-      FArrayBox flxz1D;
+      FArrayBox qleft[AMREX_SPACEDIM] = {FArrayBox(scratch), FArrayBox(scratch), FArrayBox(scratch)};
+      FArrayBox qright[AMREX_SPACEDIM] = {FArrayBox(scratch), FArrayBox(scratch), FArrayBox(scratch)};
 
-      FArrayBox ux_left;
-      FArrayBox ux_right;
-      FArrayBox uy_left;
-      FArrayBox uy_right;
-      FArrayBox uz_left;
-      FArrayBox uz_right;
+      FArrayBox flxx1D(scratch);
+      FArrayBox flxy1D(scratch);
+      FArrayBox flxz1D(scratch);
 
-      FArrayBox qtmp_left;
-      FArrayBox qtmp_right;
+      FArrayBox ux_left(scratch);
+      FArrayBox ux_right(scratch);
+      FArrayBox uy_left(scratch);
+      FArrayBox uy_right(scratch);
+      FArrayBox uz_left(scratch);
+      FArrayBox uz_right(scratch);
 
-      FArrayBox flx_xy;
-      FArrayBox flx_xz;
+      FArrayBox qtmp_left(scratch);
+      FArrayBox qtmp_right(scratch);
 
-      FArrayBox flx_yx;
-      FArrayBox flx_yz;
+      FArrayBox flx_xy(scratch);
+      FArrayBox flx_xz(scratch);
 
-      FArrayBox flx_zx;
-      FArrayBox flx_zy;
+      FArrayBox flx_yx(scratch);
+      FArrayBox flx_yz(scratch);
 
-      FArrayBox q2D;
+      FArrayBox flx_zx(scratch);
+      FArrayBox flx_zy(scratch);
 
-      FArrayBox div;
+      FArrayBox q2D(scratch);
+
+      FArrayBox div(scratch);
 
       for (MFIter mfi(S_new, TilingIfNotGPU()); mfi.isValid(); ++mfi)
         {
@@ -90,8 +104,8 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           const Box& obx = amrex::grow(bx, 1);
           const Box& gbx = amrex::grow(bx, 2);
 
-          // box with NUM_GROW ghost cells for PPM stuff
-          const Box& bx_gc = amrex::grow(bx, NUM_GROW);
+          // box with the ghost cells we need for PPM stuff
+          const Box& bx_gc = amrex::grow(bx, ng);
 
           FArrayBox &statein  = Sborder[mfi];
           auto u_arr = statein.array();
@@ -215,28 +229,33 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           }
 
-          // Interpolate Cell centered values to faces
-          qleft[0].resize(bx_gc, NQ);
+          // Interpolate Cell centered values to faces.  The
+          // reconstruction on bxi fills qright(i) and qleft(i+1), so
+          // the interface states only need one more zone than bxi.
+
+          const Box& bxq = amrex::grow(bxi, 1);
+
+          qleft[0].resize(bxq, NQ);
           auto qx_left_arr = qleft[0].array();
           auto elix_qx_left = qleft[0].elixir();
 
-          qright[0].resize(bx_gc, NQ);
+          qright[0].resize(bxq, NQ);
           auto qx_right_arr = qright[0].array();
           auto elix_qx_right = qright[0].elixir();
 
-          qleft[1].resize(bx_gc, NQ);
+          qleft[1].resize(bxq, NQ);
           auto qy_left_arr = qleft[1].array();
           auto elix_qy_left = qleft[1].elixir();
 
-          qright[1].resize(bx_gc, NQ);
+          qright[1].resize(bxq, NQ);
           auto qy_right_arr = qright[1].array();
           auto elix_qy_right = qright[1].elixir();
 
-          qleft[2].resize(bx_gc, NQ);
+          qleft[2].resize(bxq, NQ);
           auto qz_left_arr = qleft[2].array();
           auto elix_qz_left = qleft[2].elixir();
 
-          qright[2].resize(bx_gc, NQ);
+          qright[2].resize(bxq, NQ);
           auto qz_right_arr = qright[2].array();
           auto elix_qz_right = qright[2].elixir();
 
@@ -340,23 +359,19 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           eebx.growHi(1);
           eebx.growHi(2);
 
-          electric_edge_x(eebx, q_arr, Ex_arr, flxy1D_arr, flxz1D_arr);
-
-
           // [lo(1)-2, lo(2)-2, lo(3)-2][hi(1)+3, hi(2)+2, hi(3)+3]
           Box eeby = amrex::grow(bx, 2);
           eeby.growHi(0);
           eeby.growHi(2);
 
-          electric_edge_y(eeby, q_arr, Ey_arr, flxx1D_arr, flxz1D_arr);
-
-
           // [lo(1)-2, lo(2)-2, lo(3)-2][hi(1)+3, hi(2)+3, hi(3)+2]
           Box eebz = amrex::grow(bx, 2);
           eebz.growHi(0);
           eebz.growHi(1);
 
-          electric_edge_z(eebz, q_arr, Ez_arr, flxx1D_arr, flxy1D_arr);
+          electric_edges(eebx, eeby, eebz, q_arr,
+                         Ex_arr, Ey_arr, Ez_arr,
+                         flxx1D_arr, flxy1D_arr, flxz1D_arr);
 
 
           // MM CTU Steps 3, 4, and 5
@@ -482,15 +497,13 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
           {
             flxx1D_arr(i,j,k,n) = 0.5_rt * (flx_xy_arr(i,j,k,n) + flx_xz_arr(i,j,k,n));
-          });
-
-          amrex::ParallelFor(ccby, NUM_STATE+3,
+          },
+          ccby, NUM_STATE+3,
           [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
           {
             flxy1D_arr(i,j,k,n) = 0.5_rt * (flx_yx_arr(i,j,k,n) + flx_yz_arr(i,j,k,n));
-          });
-
-          amrex::ParallelFor(ccbz, NUM_STATE+3,
+          },
+          ccbz, NUM_STATE+3,
           [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
           {
             flxz1D_arr(i,j,k,n) = 0.5_rt * (flx_zx_arr(i,j,k,n) + flx_zy_arr(i,j,k,n));
@@ -503,23 +516,19 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           eebx2.growHi(1);
           eebx2.growHi(2);
 
-          electric_edge_x(eebx2, q_arr, Ex_arr, flxy1D_arr, flxz1D_arr);
-
-
           // [lo(1)-1, lo(2)-1, lo(3)-1][hi(1)+2, hi(2)+1, hi(3)+2]
           Box eeby2 = amrex::grow(bx, 1);
           eeby2.growHi(0);
           eeby2.growHi(2);
 
-          electric_edge_y(eeby2, q_arr, Ey_arr, flxx1D_arr, flxz1D_arr);
-
-
           // [lo(1)-1, lo(2)-1, lo(3)-1][hi(1)+2, hi(2)+2, hi(3)+1]
           Box eebz2 = amrex::grow(bx, 1);
           eebz2.growHi(0);
           eebz2.growHi(1);
 
-          electric_edge_z(eebz2, q_arr, Ez_arr, flxx1D_arr, flxy1D_arr);
+          electric_edges(eebx2, eeby2, eebz2, q_arr,
+                         Ex_arr, Ey_arr, Ez_arr,
+                         flxx1D_arr, flxy1D_arr, flxz1D_arr);
 
 
           // MM CTU Step 7, 8, and 9
@@ -585,21 +594,19 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
           eebxf.growHi(1, 1);
           eebxf.growHi(2, 1);
 
-          electric_edge_x(eebxf, q2D_arr, Ex_arr, flxy_arr, flxz_arr);
-
           // [lo(1), lo(2), lo(3)][hi(1)+1, hi(2), hi(3)+1]
           Box eebyf = mfi.tilebox();
           eebyf.growHi(0, 1);
           eebyf.growHi(2, 1);
 
-          electric_edge_y(eebyf, q2D_arr, Ey_arr, flxx_arr, flxz_arr);
-
           // [lo(1), lo(2), lo(3)][hi(1)+1, hi(2)+1 ,hi(3)]
           Box eebzf = mfi.tilebox();
           eebzf.growHi(0, 1);
           eebzf.growHi(1, 1);
 
-          electric_edge_z(eebzf, q2D_arr, Ez_arr, flxx_arr, flxy_arr);
+          electric_edges(eebxf, eebyf, eebzf, q2D_arr,
+                         Ex_arr, Ey_arr, Ez_arr,
+                         flxx_arr, flxy_arr, flxz_arr);
 
           // clean the final fluxes
 
@@ -637,40 +644,37 @@ Castro::construct_ctu_mhd_source(Real time, Real dt)
 
           consup_mhd(bx, dt, update_arr, flxx_arr, flxy_arr, flxz_arr);
 
-          // magnetic update
+          // magnetic update -- the three face-centered components are
+          // independent, so we update them in a single launch
 
-          Real dtdx = dt / dx[0];
+          const Real dtdx = dt / dx[0];
+#if AMREX_SPACEDIM >= 2
+          const Real dtdy = dt / dx[1];
+#else
+          const Real dtdy = 0.0_rt;
+#endif
+#if AMREX_SPACEDIM == 3
+          const Real dtdz = dt / dx[2];
+#else
+          const Real dtdz = 0.0_rt;
+#endif
 
           amrex::ParallelFor(nbx,
           [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
           {
             Bxo_arr(i,j,k) = Bx_arr(i,j,k) + dtdx *
               ((Ey_arr(i,j,k+1) - Ey_arr(i,j,k)) - (Ez_arr(i,j+1,k) - Ez_arr(i,j,k)));
-          });
-
-#if AMREX_SPACEDIM >= 2
-          dtdx = dt / dx[1];
-#else
-          dtdx = 0.0_rt;
-#endif
-
-          amrex::ParallelFor(nby,
+          },
+          nby,
           [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
           {
-            Byo_arr(i,j,k) = By_arr(i,j,k) + dtdx *
+            Byo_arr(i,j,k) = By_arr(i,j,k) + dtdy *
               ((Ez_arr(i+1,j,k) - Ez_arr(i,j,k)) - (Ex_arr(i,j,k+1) - Ex_arr(i,j,k)));
-          });
-
-#if AMREX_SPACEDIM == 3
-          dtdx = dt / dx[2];
-#else
-          dtdx = 0.0_rt;
-#endif
-
-          amrex::ParallelFor(nbz,
+          },
+          nbz,
           [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
           {
-            Bzo_arr(i,j,k) = Bz_arr(i,j,k) + dtdx *
+            Bzo_arr(i,j,k) = Bz_arr(i,j,k) + dtdz *
               ((Ex_arr(i,j+1,k) - Ex_arr(i,j,k)) - (Ey_arr(i+1,j,k) - Ey_arr(i,j,k)));
           });
 
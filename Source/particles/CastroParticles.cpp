@@ -2,6 +2,7 @@
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <fstream>
 #include <Castro.H>
 
 #include <particles_params.H>
@@ -18,6 +19,67 @@ namespace {
     std::vector<int>  timestamp_indices;
     //
     const std::string chk_tracer_particle_file("Tracer");
+
+    //
+    // The fields sampled by the particles, from particles.sample_fields.
+    // Mass fractions, X(...), are stored as the partial density and
+    // divided by the density when sampled.
+    //
+    struct particle_sample_t {
+        std::string name;
+        int type;
+        int comp;
+        bool per_mass;
+    };
+
+    std::vector<std::string> sample_fields;
+    std::vector<particle_sample_t> particle_samples;
+
+    //
+    // Cloud-in-cell interpolation of the fluid velocity to a particle.
+    // S holds the density in component 0 and the momentum in components
+    // 1 to AMREX_SPACEDIM, and the velocity is formed zone by zone.
+    //
+    template <typename P>
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+    void tracer_velocity (const P& p,
+                          const GpuArray<Real, AMREX_SPACEDIM>& plo,
+                          const GpuArray<Real, AMREX_SPACEDIM>& dxi,
+                          Array4<Real const> const& S,
+                          ParticleReal* v)
+    {
+        int idx[3] = {0, 0, 0};
+        Real w[3][2] = {{1.0_rt, 0.0_rt}, {1.0_rt, 0.0_rt}, {1.0_rt, 0.0_rt}};
+
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            const Real l = (p.pos(d) - plo[d]) * dxi[d] - 0.5_rt;
+            idx[d] = static_cast<int>(amrex::Math::floor(l));
+            w[d][1] = l - static_cast<Real>(idx[d]);
+            w[d][0] = 1.0_rt - w[d][1];
+        }
+
+        Real u[AMREX_SPACEDIM] = {0.0_rt};
+
+        for (int kk = 0; kk <= AMREX_SPACEDIM / 3; ++kk) {
+            for (int jj = 0; jj <= AMREX_SPACEDIM / 2; ++jj) {
+                for (int ii = 0; ii <= 1; ++ii) {
+                    const int i = idx[0] + ii;
+                    const int j = idx[1] + jj;
+                    const int k = idx[2] + kk;
+
+                    const Real wrhoinv = w[0][ii] * w[1][jj] * w[2][kk] / S(i,j,k,0);
+
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        u[d] += wrhoinv * S(i,j,k,1+d);
+                    }
+                }
+            }
+        }
+
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            v[d] = static_cast<ParticleReal>(u[d]);
+        }
+    }
 }
 
 void
@@ -26,15 +88,64 @@ Castro::read_particle_params ()
 
   ParmParse pp("particles");
 
+    pp.queryarr("sample_fields", sample_fields);
+
     if (ParallelDescriptor::IOProcessor())
         if (!amrex::UtilCreateDirectory(particles::timestamp_dir, 0755))
             amrex::CreateDirectoryFailed(particles::timestamp_dir);
+
+    if (ParallelDescriptor::IOProcessor() && !particles::sample_dir.empty())
+        if (!amrex::UtilCreateDirectory(particles::sample_dir, 0755))
+            amrex::CreateDirectoryFailed(particles::sample_dir);
     //
     // Force other processors to wait till directory is built.
     //
     ParallelDescriptor::Barrier();
 }
 
+void
+Castro::init_particle_samples ()
+{
+    particle_samples.clear();
+
+    for (const auto& field : sample_fields)
+    {
+        particle_sample_t sample{field, -1, -1, false};
+
+        for (int n = 0; n < NumSpec; ++n) {
+            if (field == "X(" + short_spec_names_cxx[n] + ")") {
+                sample.type = State_Type;
+                sample.comp = UFS + n;
+                sample.per_mass = true;
+            }
+        }
+
+        for (int n = 0; n < desc_lst[State_Type].nComp() && sample.type < 0; ++n) {
+            if (field == desc_lst[State_Type].name(n)) {
+                sample.type = State_Type;
+                sample.comp = n;
+            }
+        }
+
+#ifdef REACTIONS
+        for (int n = 0; n < desc_lst[Reactions_Type].nComp() && sample.type < 0; ++n) {
+            if (field == desc_lst[Reactions_Type].name(n)) {
+                sample.type = Reactions_Type;
+                sample.comp = n;
+            }
+        }
+#endif
+
+        if (sample.type < 0) {
+            amrex::Error("particles.sample_fields: unknown field " + field);
+        }
+
+        particle_samples.push_back(sample);
+
+        TracerPC->AddRealComp(true);
+    }
+}
+
 void
 Castro::init_particles ()
 {
@@ -51,6 +162,8 @@ Castro::init_particles ()
 
         TracerPC->SetVerbose(particles::particle_verbose);
 
+        init_particle_samples();
+
         if (! particles::particle_init_file.empty())
         {
             TracerPC->InitFromAsciiFile(particles::particle_init_file,0);
@@ -75,7 +188,21 @@ Castro::ParticlePlotFile(const std::string& dir)
     {
       //  We call TracerPC->Checkpoint instead of TracerPC->WritePlotFile
       //  so that the particle ids also get written out.
-        if (TracerPC)
+        if (TracerPC && !particle_samples.empty())
+        {
+            // After an advance the particle data holds the velocity,
+            // followed by the sampled fields.
+            Vector<std::string> real_comp_names;
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                real_comp_names.push_back(std::string("vel_") + static_cast<char>('x' + d));
+            }
+            for (const auto& sample : particle_samples) {
+                real_comp_names.push_back(sample.name);
+            }
+
+            TracerPC->Checkpoint(dir, chk_tracer_particle_file, true, real_comp_names);
+        }
+        else if (TracerPC)
             TracerPC->Checkpoint(dir, chk_tracer_particle_file);
     }
 }
@@ -92,6 +219,11 @@ Castro::ParticlePostRestart (const std::string& restart_file)
             TracerPC = new AmrTracerParticleContainer(parent);
 
             TracerPC->SetVerbose(particles::particle_verbose);
+
+            // The sampled attributes have to be in place before the
+            // particles are read back in.
+
+            init_particle_samples();
             //
             // We want to be able to add new particles on a restart.
             // As well as the ability to write the particles out to an ascii file.
@@ -232,11 +364,12 @@ Castro::TimestampParticles (int ngrow)
 
             MultiFab& S_new = parent->getLevel(lev).get_new_data(State_Type);
 
-            if (imax >= 0) {  // FillPatchIterator will fail otherwise
+            if (imax >= 0) {
+                // Only fill the components that are being timestamped.
                 int ng = (lev == level) ? ngrow : 1;
-                FillPatchIterator fpi(parent->getLevel(lev), S_new,
-                                      ng, time, State_Type, 0, imax+1);
-                const MultiFab& S = fpi.get_mf();
+                MultiFab S(S_new.boxArray(), S_new.DistributionMap(), imax+1, ng);
+                S.setVal(0.0);
+                getLevel(lev).expand_state(S, time, ng, timestamp_indices);
                 TracerPC->Timestamp(basename, S    , lev, time, timestamp_indices);
             } else {
                 TracerPC->Timestamp(basename, S_new, lev, time, timestamp_indices);
@@ -245,6 +378,219 @@ Castro::TimestampParticles (int ngrow)
     }
 }
 
+void
+Castro::SampleParticles (int ngrow)
+{
+    if (TracerPC == nullptr || particle_samples.empty()) {
+        return;
+    }
+
+    BL_PROFILE("Castro::SampleParticles()");
+
+    const int nsamples = static_cast<int>(particle_samples.size());
+    const int nrec = AMREX_SPACEDIM + nsamples;
+
+    const Real time = state[State_Type].curTime();
+
+    // The particles were just redistributed, but on this level they may
+    // be up to ngrow zones outside of the valid region of their box (and
+    // one zone on the finer levels), so we sample from copies of the
+    // data with those ghost zones filled, as in TimestampParticles.  Only
+    // the sampled components (and the density) are filled.
+
+    std::vector<int> state_comps{URHO};
+#ifdef REACTIONS
+    std::vector<int> react_comps;
+#endif
+
+    for (const auto& sample : particle_samples) {
+        if (sample.type == State_Type) {
+            state_comps.push_back(sample.comp);
+        }
+#ifdef REACTIONS
+        else if (sample.type == Reactions_Type) {
+            react_comps.push_back(sample.comp);
+        }
+#endif
+    }
+
+    const int state_ncomp = *(std::max_element(state_comps.begin(), state_comps.end())) + 1;
+
+    std::ofstream ofs;
+
+    if (!particles::sample_dir.empty())
+    {
+        std::string basename = particles::sample_dir;
+
+        if (basename[basename.length()-1] != '/') basename += '/';
+
+        static bool first = true;
+
+        if (first && ParallelDescriptor::IOProcessor())
+        {
+            std::ofstream header(basename + "Sample_header");
+            header << "fields:";
+            for (const auto& sample : particle_samples) {
+                header << " " << sample.name;
+            }
+            header << "\n";
+            header << "sizeof(Real) = " << sizeof(Real) << "\n";
+            header << "sizeof(Long) = " << sizeof(Long) << "\n";
+            header << "record: Real time, int level, int nparticles, int ncomp,\n"
+                   << "        Long id[nparticles], int cpu[nparticles],\n"
+                   << "        Real data[nparticles][ncomp] (position, then the fields)\n";
+        }
+        first = false;
+
+        ofs.open(amrex::Concatenate(basename + "Sample_", ParallelDescriptor::MyProc(), 5),
+                 std::ios::out | std::ios::app | std::ios::binary);
+    }
+
+    for (int lev = level; lev <= parent->finestLevel(); lev++)
+    {
+        if (TracerPC->NumberOfParticlesAtLevel(lev) <= 0) continue;
+
+        Castro& c_lev = getLevel(lev);
+
+        const int ng = (lev == level) ? ngrow : 1;
+
+        const MultiFab& S_new = c_lev.get_new_data(State_Type);
+
+        MultiFab S_fill(S_new.boxArray(), S_new.DistributionMap(), state_ncomp, ng);
+        S_fill.setVal(0.0);
+        c_lev.expand_state(S_fill, time, ng, state_comps);
+
+#ifdef REACTIONS
+        MultiFab R_fill;
+
+        if (!react_comps.empty()) {
+            const int react_ncomp = *(std::max_element(react_comps.begin(), react_comps.end())) + 1;
+
+            R_fill.define(S_new.boxArray(), S_new.DistributionMap(), react_ncomp, ng);
+            R_fill.setVal(0.0);
+
+            for (int comp : react_comps) {
+                AmrLevel::FillPatch(c_lev, R_fill, ng, time, Reactions_Type, comp, 1, comp);
+            }
+        }
+#endif
+
+        const auto plo = parent->Geom(lev).ProbLoArray();
+        const auto dxi = parent->Geom(lev).InvCellSizeArray();
+
+        const bool write_output = ofs.is_open();
+
+        std::vector<Long> h_ids;
+        std::vector<int> h_cpus;
+        std::vector<Real> h_data;
+
+        for (AmrTracerParticleContainer::ParIterType pti(*TracerPC, lev); pti.isValid(); ++pti)
+        {
+            auto& aos = pti.GetArrayOfStructs();
+            auto& soa = pti.GetStructOfArrays();
+            const int np = aos.numParticles();
+
+            if (np == 0) {
+                continue;
+            }
+
+            auto* pstruct = aos().data();
+
+            // For output, each particle's record is its position followed
+            // by the sampled fields.
+
+            Gpu::DeviceVector<Long> ids(write_output ? np : 0);
+            Gpu::DeviceVector<int> cpus(write_output ? np : 0);
+            Gpu::DeviceVector<Real> data(write_output ? static_cast<std::size_t>(np) * nrec : 0);
+
+            Long* ids_ptr = ids.data();
+            int* cpus_ptr = cpus.data();
+            Real* data_ptr = data.data();
+
+            if (write_output) {
+                amrex::ParallelFor(np,
+                [=] AMREX_GPU_DEVICE (int m) noexcept
+                {
+                    const auto& p = pstruct[m];
+
+                    ids_ptr[m] = p.id();
+                    cpus_ptr[m] = p.cpu();
+
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        data_ptr[m * nrec + d] = p.pos(d);
+                    }
+                });
+            }
+
+            Array4<Real const> const S = S_fill.const_array(pti);
+
+            for (int n = 0; n < nsamples; ++n)
+            {
+                const auto& sample = particle_samples[n];
+
+                Array4<Real const> fld = S;
+#ifdef REACTIONS
+                if (sample.type == Reactions_Type) {
+                    fld = R_fill.const_array(pti);
+                }
+#endif
+                ParticleReal* attr = soa.GetRealData(n).data();
+
+                const int comp = sample.comp;
+                const bool per_mass = sample.per_mass;
+
+                amrex::ParallelFor(np,
+                [=] AMREX_GPU_DEVICE (int m) noexcept
+                {
+                    const auto& p = pstruct[m];
+
+                    int idx[3] = {0, 0, 0};
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        idx[d] = static_cast<int>(amrex::Math::floor((p.pos(d) - plo[d]) * dxi[d]));
+                    }
+
+                    Real val = fld(idx[0],idx[1],idx[2],comp);
+                    if (per_mass) {
+                        val /= S(idx[0],idx[1],idx[2],URHO);
+                    }
+
+                    attr[m] = static_cast<ParticleReal>(val);
+
+                    if (write_output) {
+                        data_ptr[m * nrec + AMREX_SPACEDIM + n] = val;
+                    }
+                });
+            }
+
+            if (write_output) {
+                const std::size_t off = h_ids.size();
+
+                h_ids.resize(off + np);
+                h_cpus.resize(off + np);
+                h_data.resize((off + np) * nrec);
+
+                Gpu::copyAsync(Gpu::deviceToHost, ids.begin(), ids.end(), h_ids.begin() + off);
+                Gpu::copyAsync(Gpu::deviceToHost, cpus.begin(), cpus.end(), h_cpus.begin() + off);
+                Gpu::copyAsync(Gpu::deviceToHost, data.begin(), data.end(), h_data.begin() + off * nrec);
+                Gpu::streamSynchronize();
+            }
+        }
+
+        if (write_output && !h_ids.empty())
+        {
+            const int np = static_cast<int>(h_ids.size());
+
+            ofs.write(reinterpret_cast<const char*>(&time), sizeof(Real));
+            ofs.write(reinterpret_cast<const char*>(&lev), sizeof(int));
+            ofs.write(reinterpret_cast<const char*>(&np), sizeof(int));
+            ofs.write(reinterpret_cast<const char*>(&nrec), sizeof(int));
+            ofs.write(reinterpret_cast<const char*>(h_ids.data()), static_cast<std::streamsize>(h_ids.size() * sizeof(Long)));
+            ofs.write(reinterpret_cast<const char*>(h_cpus.data()), static_cast<std::streamsize>(h_cpus.size() * sizeof(int)));
+            ofs.write(reinterpret_cast<const char*>(h_data.data()), static_cast<std::streamsize>(h_data.size() * sizeof(Real)));
+        }
+    }
+}
+
 #endif
 
 void
@@ -252,29 +598,62 @@ Castro::advance_particles(int iteration, Real time, Real dt)
 {
     if (TracerPC)
     {
+        BL_PROFILE("Castro::advance_particles()");
+
         int ng = iteration;
         Real t = time + 0.5*dt;
 
-        MultiFab Ucc(grids,dmap,AMREX_SPACEDIM,ng); // cell centered velocity
+        // Only the density and momentum are needed; the velocity is
+        // computed from them as it is interpolated to the particles.
 
-        {
-            FillPatchIterator fpi(*this, Ucc, ng, t, State_Type, 0, AMREX_SPACEDIM+1);
-            MultiFab& S = fpi.get_mf();
+        AMREX_ASSERT(UMX == URHO + 1);
+
+        MultiFab S(grids, dmap, AMREX_SPACEDIM+1, ng);
+        AmrLevel::FillPatch(*this, S, ng, t, State_Type, URHO, AMREX_SPACEDIM+1);
+
+        const auto plo = geom.ProbLoArray();
+        const auto dxi = geom.InvCellSizeArray();
 
+        // Midpoint method: the first pass moves the particles to the
+        // half step, storing the old position, and the second pass does
+        // the full step with the velocity there, storing the velocity.
+
+        for (int ipass = 0; ipass < 2; ++ipass)
+        {
 #ifdef _OPENMP
-#pragma omp parallel
+#pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-            for (MFIter mfi(Ucc,true); mfi.isValid(); ++mfi)
+            for (AmrTracerParticleContainer::ParIterType pti(*TracerPC, level); pti.isValid(); ++pti)
             {
-                const Box& bx = mfi.growntilebox();
-                S[mfi].invert(1.0, bx, 0, 1);
-                for (int dir=0; dir < AMREX_SPACEDIM; ++dir) {
-                    Ucc[mfi].copy(S[mfi], bx, dir+1, bx, dir, 1);
-                    Ucc[mfi].mult(S[mfi], bx, 0, dir);
-                }
+                auto& aos = pti.GetArrayOfStructs();
+                const int np = aos.numParticles();
+                auto* pstruct = aos().data();
+
+                Array4<Real const> const S_arr = S.const_array(pti);
+
+                amrex::ParallelFor(np,
+                [=] AMREX_GPU_DEVICE (int n) noexcept
+                {
+                    auto& p = pstruct[n];
+
+                    if (p.id() <= 0) {
+                        return;
+                    }
+
+                    ParticleReal v[AMREX_SPACEDIM];
+                    tracer_velocity(p, plo, dxi, S_arr, v);
+
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        if (ipass == 0) {
+                            p.rdata(d) = p.pos(d);
+                            p.pos(d) += static_cast<ParticleReal>(0.5_rt * dt * v[d]);
+                        } else {
+                            p.pos(d) = p.rdata(d) + static_cast<ParticleReal>(dt * v[d]);
+                            p.rdata(d) = v[d];
+                        }
+                    }
+                });
             }
         }
-
-        TracerPC->AdvectWithUcc(Ucc, level, dt);
     }
 }
@@ -205,6 +205,10 @@ HypreABec::HypreABec(const BoxArray& grids,
 
 HypreABec::~HypreABec()
 {
+  if (solver_built) {
+    destroySolver();
+  }
+
   HYPRE_StructVectorDestroy(b);
   HYPRE_StructVectorDestroy(x);
 
@@ -997,6 +1001,24 @@ void HypreABec::setupSolver(Real _reltol, Real _abstol, int maxiter)
   reltol = _reltol;
   abstol = _abstol; // may be used to change tolerance for solve
 
+  if (solver_built) {
+    // The solve always uses the current matrix values, so an older
+    // hierarchy only acts as a lagged preconditioner.
+    if (nsetups_reused < setup_lag && maxiter == solver_maxiter &&
+        reltol == solver_reltol && !tol_changed) {
+      nsetups_reused++;
+      return;
+    }
+    destroySolver();
+  }
+
+  createSolver(maxiter);
+}
+
+void HypreABec::createSolver(int maxiter)
+{
+  BL_PROFILE("HypreABec::createSolver");
+
   if (solver_flag == 0) {
     HYPRE_StructSMGCreate(MPI_COMM_WORLD, &solver);
     HYPRE_StructSMGSetMemoryUse(solver, 0);
@@ -1125,12 +1147,28 @@ void HypreABec::setupSolver(Real _reltol, Real _abstol, int maxiter)
       amrex::Error("HypreABec: no such solver");
   }
   Gpu::synchronize();
+
+  solver_built = true;
+  solver_maxiter = maxiter;
+  solver_reltol = reltol;
+  nsetups_reused = 0;
+  tol_changed = false;
 }
 
 void HypreABec::clearSolver()
 {
   BL_PROFILE("HypreABec::clearSolver");
 
+  // With a setup lag the hierarchy is kept for the next setupSolver.
+  if (setup_lag > 0) {
+    return;
+  }
+
+  destroySolver();
+}
+
+void HypreABec::destroySolver()
+{
   if (solver_flag == 0) {
     HYPRE_StructSMGDestroy(solver);
   }
@@ -1160,6 +1198,8 @@ void HypreABec::clearSolver()
        HYPRE_StructSMGDestroy(precond);
     }
   }
+
+  solver_built = false;
 }
 
 void HypreABec::hbvec3 (const Box& bx,
@@ -1792,6 +1832,7 @@ void HypreABec::solve(MultiFab& dest, int icomp, MultiFab& rhs, BC_Mode inhom)
                        : reltol);
 
     if (reltol_new > reltol) {
+      tol_changed = true;
       if (solver_flag == 0) {
         HYPRE_StructSMGSetTol(solver, reltol_new);
       }
@@ -688,6 +688,10 @@ HypreMultiABec::HypreMultiABec(int _crse_level, int _fine_level,
 
 HypreMultiABec::~HypreMultiABec()
 {
+  if (solver_built) {
+    destroySolver();
+  }
+
   HYPRE_SStructVectorDestroy(b);
   HYPRE_SStructVectorDestroy(x);
 
@@ -2759,6 +2763,25 @@ void HypreMultiABec::setupSolver(Real _reltol, Real _abstol, int maxiter)
   reltol = _reltol;
   abstol = _abstol; // may be used to change tolerance for solve
 
+  if (solver_built) {
+    // The solve always uses the current matrix values, so an older
+    // hierarchy only acts as a lagged preconditioner.  FAC keeps its
+    // own copy of the operator though, so it is always rebuilt.
+    if (nsetups_reused < setup_lag && maxiter == solver_maxiter &&
+        reltol == solver_reltol && !tol_changed && solver_flag != 101) {
+      nsetups_reused++;
+      return;
+    }
+    destroySolver();
+  }
+
+  createSolver(maxiter);
+}
+
+void HypreMultiABec::createSolver(int maxiter)
+{
+  BL_PROFILE("HypreMultiABec::createSolver");
+
   BL_ASSERT(sstruct_solver == NULL);
   BL_ASSERT(solver         == NULL);
   BL_ASSERT(precond        == NULL);
@@ -3383,12 +3406,29 @@ void HypreMultiABec::setupSolver(Real _reltol, Real _abstol, int maxiter)
     std::cout << "HypreMultiABec: no such solver" << std::endl;
     exit(1);
   }
+
+  solver_built = true;
+  solver_maxiter = maxiter;
+  solver_reltol = reltol;
+  nsetups_reused = 0;
+  tol_changed = false;
 }
 
 void HypreMultiABec::clearSolver()
 {
   BL_PROFILE("HypreMultiABec::clearSolver");
 
+  // With a setup lag the hierarchy is kept for the next setupSolver.
+  if (setup_lag > 0) {
+    return;
+  }
+
+  destroySolver();
+}
+
+void HypreMultiABec::destroySolver()
+{
+
   if (solver_flag == 100) {
     HYPRE_BoomerAMGDestroy(solver);
   }
@@ -3465,6 +3505,8 @@ void HypreMultiABec::clearSolver()
   sstruct_solver = NULL;
   solver         = NULL;
   precond        = NULL;
+
+  solver_built = false;
 }
 
 void HypreMultiABec::solve()
@@ -3490,6 +3532,7 @@ void HypreMultiABec::solve()
                        : reltol);
 
     if (reltol_new > reltol) {
+      tol_changed = true;
       if (solver_flag == 100) {
         HYPRE_BoomerAMGSetTol(solver, reltol_new);
       }
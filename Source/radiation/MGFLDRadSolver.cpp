@@ -256,6 +256,23 @@ void Radiation::MGFLD_implicit_update(int level, int iteration, int ncycle)
 
       compute_coupling(coupT, kappa_p, Er_pi, jg);
 
+      // Every group only depends on the other groups through Er_pi, so
+      // their systems can also be solved together as a block.
+      const bool block_solve = radsolve::block_group_solve && level == 0;
+
+      if (block_solve) {
+        solver->levelBlockSetup(level, nGroups);
+      }
+
+      auto group_flux = [&] (int igroup)
+      {
+        solver->levelFlux(level, Flux, Er_new, igroup);
+        solver->levelFluxReg(level, flux_in, flux_out, Flux, igroup);
+
+        if (icomp_flux >= 0)
+            solver->levelFluxFaceToCenter(level, Flux, *flxcc, icomp_flux+igroup);
+      };
+
       for (int igroup=0; igroup<nGroups; ++igroup) {
 
         set_current_group(igroup);
@@ -283,18 +300,43 @@ void Radiation::MGFLD_implicit_update(int level, int iteration, int ncycle)
                            Er_step, rhoe_step, Er_star, rhoe_star,
                            delta_t, igroup, it, ptc_tau);
 
-          // solve Er equation and put solution in Er_new(igroup)
-          solver->levelSolve(level, Er_new, igroup, rhs, 0.01);
+          if (block_solve) {
+            solver->levelBlockAdd(level, igroup, rhs);
+          }
+          else {
+            // solve Er equation and put solution in Er_new(igroup)
+            solver->levelSolve(level, Er_new, igroup, rhs, 0.01);
+          }
         } // end src and rhs block
 
-        solver->levelFlux(level, Flux, Er_new, igroup);
-        solver->levelFluxReg(level, flux_in, flux_out, Flux, igroup);
-
-        if (icomp_flux >= 0)
-            solver->levelFluxFaceToCenter(level, Flux, *flxcc, icomp_flux+igroup);
+        if (!block_solve) {
+          group_flux(igroup);
+        }
 
       } // end loop over groups
 
+      if (block_solve) {
+        solver->levelBlockSolve(level, Er_new, 0);
+
+        // the fluxes need the boundary data and b coefficients of each group
+
+        for (int igroup=0; igroup<nGroups; ++igroup) {
+
+          set_current_group(igroup);
+
+          solver->levelBndry(mgbd, igroup);
+
+          int lamcomp = (radiation::limiter==0) ? 0 : igroup;
+          solver->levelBCoeffs(level, lambda, kappa_r, igroup, c, lamcomp);
+
+          if (have_Sanchez_Pomraning) {
+            solver->levelSPas(level, lambda, igroup, lo_bc, hi_bc);
+          }
+
+          group_flux(igroup);
+        }
+      }
+
       // Check for convergence *before* acceleration step:
       check_convergence_er(relative_in, absolute_in, error_er, Er_new, Er_pi,
                            kappa_p, etaTz, temp_new, delta_t);
@@ -2,6 +2,8 @@
 #include <AMReX_ParmParse.H>
 #include <AMReX_AmrLevel.H>
 #include <AMReX_LO_BCTYPES.H>
+#include <AMReX_MLABecLaplacian.H>
+#include <AMReX_MLMG.H>
 
 #include <RadSolve.H>
 #include <Radiation.H>  // for access to static physical constants only
@@ -22,7 +24,10 @@ RadSolve::RadSolve (Amr* Parent, int level, const BoxArray& grids, const Distrib
     read_params();
 
     if (radsolve::level_solver_flag < 100) {
+        // With use_mlmg the HypreABec still holds the coefficients and
+        // boundary data, and does the solves on the finer levels.
         hd.reset(new HypreABec(grids, dmap, parent->Geom(level), radsolve::level_solver_flag));
+        hd->setSetupLag(radsolve::setup_lag);
     }
     else {
         if (radsolve::use_hypre_nonsymmetric_terms == 0) {
@@ -30,6 +35,7 @@ RadSolve::RadSolve (Amr* Parent, int level, const BoxArray& grids, const Distrib
             hm->addLevel(level, parent->Geom(level), grids, dmap,
                          IntVect::TheUnitVector());
             hm->buildMatrixStructure();
+            hm->setSetupLag(radsolve::setup_lag);
         }
         else {
             hem.reset(new HypreExtMultiABec(level, level, radsolve::level_solver_flag));
@@ -39,6 +45,7 @@ RadSolve::RadSolve (Amr* Parent, int level, const BoxArray& grids, const Distrib
             hem->addLevel(level, parent->Geom(level), grids, dmap,
                           IntVect::TheUnitVector());
             hem->buildMatrixStructure();
+            hem->setSetupLag(radsolve::setup_lag);
         }
     }
 }
@@ -57,6 +64,20 @@ RadSolve::read_params ()
 
     // Check for unsupported options.
 
+    if (radsolve::use_mlmg) {
+        if (radsolve::level_solver_flag >= 100 || radsolve::use_hypre_nonsymmetric_terms) {
+            amrex::Error("radsolve.use_mlmg requires level_solver_flag < 100 and no nonsymmetric terms");
+        }
+    }
+
+    if (radsolve::block_group_solve && !radsolve::use_mlmg) {
+        amrex::Error("radsolve.block_group_solve requires use_mlmg");
+    }
+
+    if (radsolve::setup_lag < 0) {
+        amrex::Error("radsolve.setup_lag must be non-negative");
+    }
+
     if (AMREX_SPACEDIM == 1) {
         if (radsolve::level_solver_flag == 1) {
             amrex::Error("radsolve.level_solver_flag = 1 is not supported in 1D");
@@ -592,7 +613,10 @@ void RadSolve::levelSolve(int level,
     hem->setScalars(radsolve::alpha, radsolve::beta);
   }
 
-  if (hd) {
+  if (hd && radsolve::use_mlmg && level == 0) {
+    levelSolveMLMG(level, Er, igroup, rhs);
+  }
+  else if (hd) {
     hd->setupSolver(radsolve::reltol, radsolve::abstol, radsolve::maxiter);
     hd->solve(Er, igroup, rhs, Inhomogeneous_BC);
     Real res = hd->getAbsoluteResidual();
@@ -640,6 +664,273 @@ void RadSolve::levelSolve(int level,
   }
 }
 
+void RadSolve::levelSolveMLMG(int level, MultiFab& Er, int igroup, const MultiFab& rhs)
+{
+  BL_PROFILE("RadSolve::levelSolveMLMG");
+
+  const BoxArray& grids = parent->boxArray(level);
+  const DistributionMapping& dmap = parent->DistributionMap(level);
+
+  MultiFab sol(grids, dmap, 1, 1);
+  sol.setVal(0.0);
+  MultiFab::Copy(sol, Er, igroup, 0, 1, 0);
+
+  MultiFab robin_a(grids, dmap, 1, 1);
+  MultiFab robin_b(grids, dmap, 1, 1);
+  MultiFab robin_f(grids, dmap, 1, 1);
+
+  levelRobinBC(level, robin_a, robin_b, robin_f);
+
+  solveMLMG(level, sol, rhs, hd->aCoefficients(),
+            {AMREX_D_DECL(&hd->bCoefficients(0),
+                          &hd->bCoefficients(1),
+                          &hd->bCoefficients(2))},
+            robin_a, robin_b, robin_f);
+
+  MultiFab::Copy(Er, sol, 0, igroup, 1, 0);
+}
+
+void RadSolve::levelBlockSetup(int level, int ncomp)
+{
+  BL_PROFILE("RadSolve::levelBlockSetup");
+
+  const BoxArray& grids = parent->boxArray(level);
+  const DistributionMapping& dmap = parent->DistributionMap(level);
+
+  if (block_rhs == nullptr || block_rhs->nComp() != ncomp) {
+    block_acoefs = std::make_unique<MultiFab>(grids, dmap, ncomp, 0);
+    for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      block_bcoefs[idim] = std::make_unique<MultiFab>(hd->bCoefficients(idim).boxArray(),
+                                                      dmap, ncomp, 0);
+    }
+    block_rhs = std::make_unique<MultiFab>(grids, dmap, ncomp, 0);
+    block_robin_a = std::make_unique<MultiFab>(grids, dmap, ncomp, 1);
+    block_robin_b = std::make_unique<MultiFab>(grids, dmap, ncomp, 1);
+    block_robin_f = std::make_unique<MultiFab>(grids, dmap, ncomp, 1);
+  }
+}
+
+void RadSolve::levelBlockAdd(int level, int comp, const MultiFab& rhs)
+{
+  BL_PROFILE("RadSolve::levelBlockAdd");
+
+  // boundaryFlux still uses the scalars of the HypreABec
+
+  hd->setScalars(radsolve::alpha, radsolve::beta);
+
+  MultiFab::Copy(*block_acoefs, hd->aCoefficients(), 0, comp, 1, 0);
+  for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+    MultiFab::Copy(*block_bcoefs[idim], hd->bCoefficients(idim), 0, comp, 1, 0);
+  }
+  MultiFab::Copy(*block_rhs, rhs, 0, comp, 1, 0);
+
+  levelRobinBC(level, *block_robin_a, *block_robin_b, *block_robin_f, comp);
+}
+
+void RadSolve::levelBlockSolve(int level, MultiFab& Er, int comp0)
+{
+  BL_PROFILE("RadSolve::levelBlockSolve");
+
+  const BoxArray& grids = parent->boxArray(level);
+  const DistributionMapping& dmap = parent->DistributionMap(level);
+  const int ncomp = block_rhs->nComp();
+
+  MultiFab sol(grids, dmap, ncomp, 1);
+  sol.setVal(0.0);
+  MultiFab::Copy(sol, Er, comp0, 0, ncomp, 0);
+
+  // The convergence test is over all of the components, so scale each
+  // one by the size of its data, or groups with little energy would
+  // hardly be converged.
+
+  Vector<Real> scale(ncomp);
+
+  for (int n = 0; n < ncomp; n++) {
+    scale[n] = std::max(block_rhs->norminf(n, 0), block_robin_f->norminf(n, 1));
+    if (scale[n] <= 0.0_rt) {
+      scale[n] = 1.0_rt;
+    }
+
+    block_rhs->mult(1.0_rt / scale[n], n, 1, 0);
+    block_robin_f->mult(1.0_rt / scale[n], n, 1, 1);
+    sol.mult(1.0_rt / scale[n], n, 1, 0);
+  }
+
+  solveMLMG(level, sol, *block_rhs, *block_acoefs,
+            {AMREX_D_DECL(block_bcoefs[0].get(),
+                          block_bcoefs[1].get(),
+                          block_bcoefs[2].get())},
+            *block_robin_a, *block_robin_b, *block_robin_f);
+
+  for (int n = 0; n < ncomp; n++) {
+    sol.mult(scale[n], n, 1, 0);
+  }
+
+  MultiFab::Copy(Er, sol, 0, comp0, ncomp, 0);
+}
+
+void RadSolve::solveMLMG(int level, MultiFab& sol, const MultiFab& rhs,
+                         const MultiFab& acoefs,
+                         const Array<MultiFab const*, AMREX_SPACEDIM>& bcoefs,
+                         const MultiFab& robin_a, const MultiFab& robin_b,
+                         const MultiFab& robin_f)
+{
+  const Geometry& geom = parent->Geom(level);
+  const int ncomp = sol.nComp();
+
+  // The coefficients and the rhs already carry the metric factors.
+
+  LPInfo info;
+  info.setMetricTerm(false);
+
+  MLABecLaplacian mlabec({geom}, {sol.boxArray()}, {sol.DistributionMap()}, info, {}, ncomp);
+
+  // Only use the first interior zone in the boundary stencil, so that
+  // with the Robin coefficients from levelRobinBC this gives the same
+  // (first order, bho = 0) boundary rows as HypreABec.
+
+  mlabec.setMaxOrder(2);
+
+  std::array<MLLinOp::BCType, AMREX_SPACEDIM> lobc;
+  std::array<MLLinOp::BCType, AMREX_SPACEDIM> hibc;
+
+  for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+    if (geom.isPeriodic(idim)) {
+      lobc[idim] = MLLinOp::BCType::Periodic;
+      hibc[idim] = MLLinOp::BCType::Periodic;
+    }
+    else {
+      lobc[idim] = MLLinOp::BCType::Robin;
+      hibc[idim] = MLLinOp::BCType::Robin;
+    }
+  }
+
+  mlabec.setDomainBC(lobc, hibc);
+
+  mlabec.setLevelBC(0, &sol, &robin_a, &robin_b, &robin_f);
+
+  mlabec.setScalars(radsolve::alpha, radsolve::beta);
+  mlabec.setACoeffs(0, acoefs);
+  mlabec.setBCoeffs(0, bcoefs);
+
+  MLMG mlmg(mlabec);
+  mlmg.setMaxIter(radsolve::maxiter);
+  mlmg.setVerbose(radsolve::verbose);
+
+  mlmg.solve({&sol}, {&rhs}, radsolve::reltol, radsolve::abstol);
+}
+
+void RadSolve::levelRobinBC(int level, MultiFab& robin_a,
+                            MultiFab& robin_b, MultiFab& robin_f, int comp)
+{
+  BL_PROFILE("RadSolve::levelRobinBC");
+
+  // MLMG fills the ghost zone g next to the valid zone v from
+  //
+  //   a phi + b dphi/dn = f,
+  //
+  // with phi = (phi_g + phi_v) / 2 and dphi/dn = (phi_g - phi_v) / h
+  // along the outward normal.  HypreABec instead eliminates the
+  // boundary flux B (phi_v - phi_g) / h through the face, and the
+  // coefficients below give the same rows:
+  //
+  //   Dirichlet at distance bcl:  a = 1, b = bcl,           f = value
+  //   Neumann:                    a = 0, b = B,             f = r value
+  //   Marshak / Sanchez-Pomraning a = 2 r g, b = B - r g h, f = 2 r value
+  //
+  // where g = c/4 (Marshak) or g = c alpha_SP, and r is the face metric.
+
+  robin_a.setVal(0.0, comp, 1, 1);
+  robin_b.setVal(1.0, comp, 1, 1);
+  robin_f.setVal(0.0, comp, 1, 1);
+
+  const Geometry& geom = parent->Geom(level);
+  const auto geomdata = geom.data();
+  const Box& domain = geom.Domain();
+
+  const NGBndry& bd = hd->getBndry();
+  const int bdcomp = hd->getBndryComp();
+  const MultiFab* spa = hd->SPalpha();
+  const Real c = HypreABec::fluxFactor();
+
+  for (MFIter mfi(robin_a); mfi.isValid(); ++mfi) {
+    const int igrid = mfi.index();
+    const Box& reg = mfi.validbox();
+
+    auto ra = robin_a.array(mfi, comp);
+    auto rb = robin_b.array(mfi, comp);
+    auto rf = robin_f.array(mfi, comp);
+
+    Array4<Real const> spa_arr = spa != nullptr ? spa->const_array(mfi) : Array4<Real const>{};
+
+    for (OrientationIter oitr; oitr; oitr++) {
+      const Orientation ori = oitr();
+      const int idim = ori.coordDir();
+
+      if (geom.isPeriodic(idim) || reg[ori] != domain[ori]) {
+        continue;
+      }
+
+      const int ori_lo = ori.isLow();
+      const Real h = geom.CellSize(idim);
+      const int rlo = reg.smallEnd(0);
+      const int rhi = reg.bigEnd(0);
+
+      int bctype = bd.bndryConds(ori)[igrid];
+      Array4<int const> tf{};
+      if (bd.mixedBndry(ori)) {
+        tf = bd.bndryTypes(ori)[igrid]->const_array();
+        bctype = -1;
+      }
+
+      const Real bcl = bd.bndryLocs(ori)[igrid];
+      auto bcval = bd.bndryValues(ori)[mfi].const_array(bdcomp);
+      auto b = hd->bCoefficients(idim).const_array(mfi);
+
+      // offset from the ghost zone to the valid zone next to it
+
+      const int s = ori_lo ? 1 : -1;
+      const int si = idim == 0 ? s : 0;
+      const int sj = idim == 1 ? s : 0;
+      const int sk = idim == 2 ? s : 0;
+
+      amrex::ParallelFor(amrex::adjCell(reg, ori),
+      [=] AMREX_GPU_HOST_DEVICE (int i, int j, int k)
+      {
+          const int iv = i + si;
+          const int jv = j + sj;
+          const int kv = k + sk;
+
+          // the face index is that of the zone on its high side
+
+          const Real B = ori_lo ? b(iv,jv,kv) : b(i,j,k);
+
+          Real r;
+          face_metric(iv, jv, kv, rlo, rhi, geomdata, idim, ori_lo, r);
+
+          const int bct = bctype == -1 ? tf(i,j,k) : bctype;
+
+          if (bct == AMREX_LO_DIRICHLET) {
+              ra(i,j,k) = 1.0_rt;
+              rb(i,j,k) = bcl;
+              rf(i,j,k) = bcval(i,j,k);
+          }
+          else if (bct == AMREX_LO_NEUMANN) {
+              ra(i,j,k) = 0.0_rt;
+              rb(i,j,k) = B;
+              rf(i,j,k) = r * bcval(i,j,k);
+          }
+          else {
+              const Real g = bct == AMREX_LO_MARSHAK ? 0.25_rt * c : spa_arr(iv,jv,kv) * c;
+              ra(i,j,k) = 2.0_rt * r * g;
+              rb(i,j,k) = B - r * g * h;
+              rf(i,j,k) = 2.0_rt * r * bcval(i,j,k);
+          }
+      });
+    }
+  }
+}
+
 void RadSolve::levelFluxFaceToCenter(int level, const Array<MultiFab, AMREX_SPACEDIM>& Flux,
                                      MultiFab& flx, int iflx)
 {
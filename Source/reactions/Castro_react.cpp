@@ -6,6 +6,10 @@
 #endif
 #include <sdc_cons_to_burn.H>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using std::string;
 using namespace amrex;
 
@@ -127,14 +131,235 @@ Castro::do_new_reactions (Real time, Real dt)
     return status;
 }
 
+// A zone to be burned in the compacted react_state: the (global) index
+// of its box and its location.
+
+struct ReactZone
+{
+    int box;
+    int i;
+    int j;
+    int k;
+};
+
+// Burn a single zone for the Strang react_state, updating the state and
+// the reactions and burn weights diagnostics.  Returns 1 if the burn failed.
+
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+int
+react_zone (int i, int j, int k,
+            Array4<Real> const& U,
+            Array4<Real> const& reactions,
+            Array4<Real> const& weights,
+            Array4<Real const> const& mask,
+            const bool mask_covered_zones,
+            const GeometryData& geomdata,
+            const Real time, const Real dt,
+            const int strang_half, const int level)
+{
+    amrex::ignore_unused(time, level);
+
+    const Real* dx = geomdata.CellSize();
+#ifdef MODEL_PARSER
+    const Real* problo = geomdata.ProbLo();
+#endif
+
+    burn_t burn_state;
+#ifdef NSE_NET
+    burn_state.mu_p = U(i,j,k,UMUP);
+    burn_state.mu_n = U(i,j,k,UMUN);
+
+    burn_state.y_e = -1.0_rt;
+#endif
+
+#if AMREX_SPACEDIM == 1
+    burn_state.dx = dx[0];
+#else
+    burn_state.dx = amrex::min(AMREX_D_DECL(dx[0], dx[1], dx[2]));
+#endif
+
+    // Initialize some data for later.
+
+    bool do_burn = true;
+    burn_state.success = true;
+    int burn_failed = 0;
+
+    // Don't burn on zones inside shock regions, if the relevant option is set.
+
+#ifdef SHOCK_VAR
+    if (U(i,j,k,USHK) > 0.0_rt && disable_shock_burning == 1) {
+        do_burn = false;
+    }
+#endif
+    // Don't burn on zones that are masked out.
+
+    if (mask_covered_zones && mask.contains(i,j,k)) {
+        if (mask(i,j,k) == 0.0_rt) {
+            do_burn = false;
+        }
+    }
+
+    Real rhoInv = 1.0_rt / U(i,j,k,URHO);
+
+    burn_state.rho = U(i,j,k,URHO);
+
+    // e is used as an input for some NSE solvers
+
+    burn_state.e = U(i,j,k,UEINT) * rhoInv;
+
+    // this T is consistent with UEINT because we did an EOS call before
+    // calling this function
+
+    burn_state.T = U(i,j,k,UTEMP);
+
+    burn_state.T_fixed = -1.e30_rt;
+
+#ifdef MODEL_PARSER
+    if (drive_initial_convection) {
+        GpuArray<Real, 3> rr = {0.0_rt};
+
+        rr[0] = problo[0] + dx[0] * (static_cast<Real>(i) + 0.5_rt) - problem::center[0];
+#if AMREX_SPACEDIM >= 2
+        rr[1] = problo[1] + dx[1] * (static_cast<Real>(j) + 0.5_rt) - problem::center[1];
+#endif
+#if AMREX_SPACEDIM == 3
+        rr[2] = problo[2] + dx[2] * (static_cast<Real>(k) + 0.5_rt) - problem::center[2];
+#endif
+
+        Real dist;
+
+        if (domain_is_plane_parallel) {
+            dist = rr[AMREX_SPACEDIM-1];
+        } else {
+            dist = distance(geomdata, rr);
+        }
+
+        burn_state.T_fixed = interpolate(dist, model::itemp);
+
+    }
+#endif
+
+    for (int n = 0; n < NumSpec; ++n) {
+        burn_state.xn[n] = U(i,j,k,UFS+n) * rhoInv;
+    }
+
+#if NAUX_NET > 0
+    for (int n = 0; n < NumAux; ++n) {
+        burn_state.aux[n] = U(i,j,k,UFX+n) * rhoInv;
+    }
+#endif
+
+    // Ensure we start with no RHS or Jacobian calls registered.
+
+    burn_state.n_rhs = 0;
+    burn_state.n_jac = 0;
+
+    // for diagnostics
+
+    burn_state.i = i;
+    burn_state.j = j;
+    burn_state.k = k;
+
+#ifdef NONAKA_PLOT
+    burn_state.level = level;
+    burn_state.reference_time = time;
+#ifdef STRANG
+    burn_state.strang_half = strang_half;
+#endif
+#endif
+
+    // Don't burn if we're outside of the relevant (rho, T) range.
+
+    if (burn_state.T < castro::react_T_min || burn_state.T > castro::react_T_max ||
+        burn_state.rho < castro::react_rho_min || burn_state.rho > castro::react_rho_max) {
+        do_burn = false;
+    }
+
+    if (do_burn) {
+        burner(burn_state, dt);
+
+        // If we were unsuccessful, update the failure count.
+
+        if (!burn_state.success) {
+            burn_failed = 1;
+        }
+
+        // Add burning rates to reactions MultiFab, but be
+        // careful because the reactions and state MFs may
+        // not have the same number of ghost cells.
+
+        if (reactions.contains(i,j,k)) {
+
+            reactions(i,j,k,0) = (U(i,j,k,URHO) * burn_state.e - U(i,j,k,UEINT)) / dt;
+
+            if (store_omegadot == 1) {
+                if (reactions.contains(i,j,k)) {
+                    for (int n = 0; n < NumSpec; ++n) {
+                        reactions(i,j,k,1+n) = U(i,j,k,URHO) * (burn_state.xn[n] - U(i,j,k,UFS+n) * rhoInv) / dt;
+                    }
+#if NAUX_NET > 0
+                    for (int n = 0; n < NumAux; ++n) {
+                        reactions(i,j,k,1+n+NumSpec) = U(i,j,k,URHO) * (burn_state.aux[n] - U(i,j,k,UFX+n) * rhoInv) / dt;
+                    }
+#endif
+                }
+            }
+
+            if (store_burn_weights) {
+
+                if (integrator_rp::jacobian == 1) {
+                    weights(i,j,k,strang_half) = amrex::max(1.0_rt, static_cast<Real>(burn_state.n_rhs + 2 * burn_state.n_jac));
+                } else {
+                    // the RHS evals for the numerical differencing in the Jacobian are already accounted for in n_rhs
+                    weights(i,j,k,strang_half) = amrex::max(1.0_rt, static_cast<Real>(burn_state.n_rhs));
+                }
+            }
+#ifdef NSE
+            if (store_omegadot == 1) {
+                reactions(i,j,k,NumSpec+NumAux+1) = burn_state.nse;
+            }
+            else {
+                reactions(i,j,k,1) = burn_state.nse;
+            }
+#endif
+        }
+
+        // update the state
+#ifdef NSE_NET
+        U(i,j,k,UMUP) = burn_state.mu_p;
+        U(i,j,k,UMUN) = burn_state.mu_n;
+#endif
+        for (int n = 0; n < NumSpec; ++n) {
+            U(i,j,k,UFS+n) = U(i,j,k,URHO) * burn_state.xn[n];
+        }
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; ++n) {
+            U(i,j,k,UFX+n) = U(i,j,k,URHO) * burn_state.aux[n];
+        }
+#endif
+        Real reint_old = U(i,j,k,UEINT);
+        U(i,j,k,UEINT) = U(i,j,k,URHO) * burn_state.e;
+        U(i,j,k,UEDEN) += U(i,j,k,UEINT) - reint_old;
+
+    } else {  // do_burn = false
+
+        if (reactions.contains(i,j,k)) {
+            for (int n = 0; n < reactions.nComp(); n++) {
+                reactions(i,j,k,n) = 0.0_rt;
+            }
+        }
+
+    }
+
+    return burn_failed;
+}
+
 // Strang version
 
 int
 Castro::react_state(MultiFab& s, MultiFab& r, Real time, Real dt, const int strang_half)
 {
 
-    amrex::ignore_unused(time);
-
     BL_PROFILE("Castro::react_state()");
 
     // Sanity check: should only be in here if we're doing CTU.
@@ -192,237 +417,148 @@ Castro::react_state(MultiFab& s, MultiFab& r, Real time, Real dt, const int stra
 #endif
     int num_failed = 0;
 
-#ifdef _OPENMP
-#pragma omp parallel reduction(+:num_failed)
-#endif
-    for (MFIter mfi(s, TilingIfNotGPU()); mfi.isValid(); ++mfi)
-    {
+    const auto geomdata = geom.data();
+    const int lev = level;
 
-        const Box& bx = mfi.growntilebox(ng);
+#ifndef AMREX_USE_GPU
+    if (react_compact_zones) {
 
-        auto U = s.array(mfi);
-        auto reactions = r.array(mfi);
-        auto weights = store_burn_weights ? burn_weights.array(mfi) : Array4<Real>{};
-        Array4<Real> empty_arr{};
-        const auto& mask = mask_covered_zones ? mask_mf.array(mfi) : empty_arr;
+        // Build a list of the zones that will actually be burned (zeroing
+        // the reactions data in the others) and then distribute this list
+        // dynamically over the threads, so that the few tiles holding the
+        // burning zones don't hold up the rest.
 
-        const auto dx = geom.CellSizeArray();
-#ifdef MODEL_PARSER
-        const auto problo = geom.ProbLoArray();
-        const auto geomdata = geom.data();
-#endif
+        Vector<ReactZone> zones;
 
-#if defined(AMREX_USE_GPU)
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k)
-#else
-        LoopOnCpu(bx, [&] (int i, int j, int k)
+#ifdef _OPENMP
+        Vector<Vector<ReactZone>> thread_zones(omp_get_max_threads());
+#pragma omp parallel
 #endif
         {
-
-            burn_t burn_state;
-#ifdef NSE_NET
-            burn_state.mu_p = U(i,j,k,UMUP);
-            burn_state.mu_n = U(i,j,k,UMUN);
-
-            burn_state.y_e = -1.0_rt;
-#endif
-
-#if AMREX_SPACEDIM == 1
-            burn_state.dx = dx[0];
+#ifdef _OPENMP
+            auto& my_zones = thread_zones[omp_get_thread_num()];
 #else
-            burn_state.dx = amrex::min(AMREX_D_DECL(dx[0], dx[1], dx[2]));
+            auto& my_zones = zones;
 #endif
 
-            // Initialize some data for later.
+            for (MFIter mfi(s, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+            {
+                const Box& bx = mfi.growntilebox(ng);
+                const int box = mfi.index();
 
-            bool do_burn = true;
-            burn_state.success = true;
-            int burn_failed = 0;
+                auto U = s.const_array(mfi);
+                auto reactions = r.array(mfi);
 
-            // Don't burn on zones inside shock regions, if the relevant option is set.
+                // Only boxes the finer level (partly) covers need the mask.
 
-#ifdef SHOCK_VAR
-            if (U(i,j,k,USHK) > 0.0_rt && disable_shock_burning == 1) {
-                do_burn = false;
-            }
-#endif
-            // Don't burn on zones that are masked out.
-
-            if (mask_covered_zones && mask.contains(i,j,k)) {
-                if (mask(i,j,k) == 0.0_rt) {
-                    do_burn = false;
-                }
-            }
-
-            Real rhoInv = 1.0_rt / U(i,j,k,URHO);
+                const bool mask_tile = mask_covered_zones && fine_mask_coverage_of(mfi) != fine_coverage::none;
 
-            burn_state.rho = U(i,j,k,URHO);
+                auto mask = mask_tile ? mask_mf.const_array(mfi) : Array4<Real const>{};
 
-            // e is used as an input for some NSE solvers
+                LoopOnCpu(bx, [&] (int i, int j, int k)
+                {
+                    bool do_burn = true;
 
-            burn_state.e = U(i,j,k,UEINT) * rhoInv;
-
-            // this T is consistent with UEINT because we did an EOS call before
-            // calling this function
-
-            burn_state.T = U(i,j,k,UTEMP);
-
-            burn_state.T_fixed = -1.e30_rt;
-
-#ifdef MODEL_PARSER
-            if (drive_initial_convection) {
-                GpuArray<Real, 3> rr = {0.0_rt};
+                    if (U(i,j,k,UTEMP) < castro::react_T_min || U(i,j,k,UTEMP) > castro::react_T_max ||
+                        U(i,j,k,URHO) < castro::react_rho_min || U(i,j,k,URHO) > castro::react_rho_max) {
+                        do_burn = false;
+                    }
 
-                rr[0] = problo[0] + dx[0] * (static_cast<Real>(i) + 0.5_rt) - problem::center[0];
-#if AMREX_SPACEDIM >= 2
-                rr[1] = problo[1] + dx[1] * (static_cast<Real>(j) + 0.5_rt) - problem::center[1];
-#endif
-#if AMREX_SPACEDIM == 3
-                rr[2] = problo[2] + dx[2] * (static_cast<Real>(k) + 0.5_rt) - problem::center[2];
+#ifdef SHOCK_VAR
+                    if (U(i,j,k,USHK) > 0.0_rt && disable_shock_burning == 1) {
+                        do_burn = false;
+                    }
 #endif
 
-                Real dist;
-
-                if (domain_is_plane_parallel) {
-                    dist = rr[AMREX_SPACEDIM-1];
-                } else {
-                    dist = distance(geomdata, rr);
-                }
-
-                burn_state.T_fixed = interpolate(dist, model::itemp);
-
-            }
-#endif
+                    if (mask_tile && mask.contains(i,j,k)) {
+                        if (mask(i,j,k) == 0.0_rt) {
+                            do_burn = false;
+                        }
+                    }
 
-            for (int n = 0; n < NumSpec; ++n) {
-                burn_state.xn[n] = U(i,j,k,UFS+n) * rhoInv;
+                    if (do_burn) {
+                        my_zones.push_back({box, i, j, k});
+                    }
+                    else if (reactions.contains(i,j,k)) {
+                        for (int n = 0; n < reactions.nComp(); n++) {
+                            reactions(i,j,k,n) = 0.0_rt;
+                        }
+                    }
+                });
             }
+        }
 
-#if NAUX_NET > 0
-            for (int n = 0; n < NumAux; ++n) {
-                burn_state.aux[n] = U(i,j,k,UFX+n) * rhoInv;
-            }
+#ifdef _OPENMP
+        for (const auto& tz : thread_zones) {
+            zones.insert(zones.end(), tz.begin(), tz.end());
+        }
 #endif
 
-            // Ensure we start with no RHS or Jacobian calls registered.
-
-            burn_state.n_rhs = 0;
-            burn_state.n_jac = 0;
-
-            // for diagnostics
+        const int nzones = static_cast<int>(zones.size());
 
-            burn_state.i = i;
-            burn_state.j = j;
-            burn_state.k = k;
-
-#ifdef NONAKA_PLOT
-            burn_state.level = level;
-            burn_state.reference_time = time;
-#ifdef STRANG
-            burn_state.strang_half = strang_half;
-#endif
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 4) reduction(+:num_failed)
 #endif
+        for (int n = 0; n < nzones; ++n) {
+            const auto& z = zones[n];
 
-            // Don't burn if we're outside of the relevant (rho, T) range.
-
-            if (burn_state.T < castro::react_T_min || burn_state.T > castro::react_T_max ||
-                burn_state.rho < castro::react_rho_min || burn_state.rho > castro::react_rho_max) {
-                do_burn = false;
-            }
+            auto weights = store_burn_weights ? burn_weights.array(z.box) : Array4<Real>{};
 
-            if (do_burn) {
-                burner(burn_state, dt);
+            // The covered zones were already left out of the list.
 
-                // If we were unsuccessful, update the failure count.
-
-                if (!burn_state.success) {
-                    burn_failed = 1;
-                }
-
-                // Add burning rates to reactions MultiFab, but be
-                // careful because the reactions and state MFs may
-                // not have the same number of ghost cells.
-
-                if (reactions.contains(i,j,k)) {
-
-                    reactions(i,j,k,0) = (U(i,j,k,URHO) * burn_state.e - U(i,j,k,UEINT)) / dt;
+            num_failed += react_zone(z.i, z.j, z.k, s.array(z.box), r.array(z.box), weights, Array4<Real const>{},
+                                     false, geomdata, time, dt, strang_half, lev);
+        }
 
-                    if (store_omegadot == 1) {
-                        if (reactions.contains(i,j,k)) {
-                            for (int n = 0; n < NumSpec; ++n) {
-                                reactions(i,j,k,1+n) = U(i,j,k,URHO) * (burn_state.xn[n] - U(i,j,k,UFS+n) * rhoInv) / dt;
-                            }
-#if NAUX_NET > 0
-                            for (int n = 0; n < NumAux; ++n) {
-                                reactions(i,j,k,1+n+NumSpec) = U(i,j,k,URHO) * (burn_state.aux[n] - U(i,j,k,UFX+n) * rhoInv) / dt;
-                            }
+    }
+    else
 #endif
-                        }
-                    }
-
-                    if (store_burn_weights) {
+    {
 
-                        if (integrator_rp::jacobian == 1) {
-                            weights(i,j,k,strang_half) = amrex::max(1.0_rt, static_cast<Real>(burn_state.n_rhs + 2 * burn_state.n_jac));
-                        } else {
-                            // the RHS evals for the numerical differencing in the Jacobian are already accounted for in n_rhs
-                            weights(i,j,k,strang_half) = amrex::max(1.0_rt, static_cast<Real>(burn_state.n_rhs));
-                        }
-                    }
-#ifdef NSE
-                    if (store_omegadot == 1) {
-                        reactions(i,j,k,NumSpec+NumAux+1) = burn_state.nse;
-                    }
-                    else {
-                        reactions(i,j,k,1) = burn_state.nse;
-                    }
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:num_failed)
 #endif
-                }
+        for (MFIter mfi(s, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
 
-                // update the state
-#ifdef NSE_NET
-                U(i,j,k,UMUP) = burn_state.mu_p;
-                U(i,j,k,UMUN) = burn_state.mu_n;
-#endif
-                for (int n = 0; n < NumSpec; ++n) {
-                    U(i,j,k,UFS+n) = U(i,j,k,URHO) * burn_state.xn[n];
-                }
-#if NAUX_NET > 0
-                for (int n = 0; n < NumAux; ++n) {
-                    U(i,j,k,UFX+n) = U(i,j,k,URHO) * burn_state.aux[n];
-                }
-#endif
-                Real reint_old = U(i,j,k,UEINT);
-                U(i,j,k,UEINT) = U(i,j,k,URHO) * burn_state.e;
-                U(i,j,k,UEDEN) += U(i,j,k,UEINT) - reint_old;
+            const Box& bx = mfi.growntilebox(ng);
 
-            } else {  // do_burn = false
+            auto U = s.array(mfi);
+            auto reactions = r.array(mfi);
+            auto weights = store_burn_weights ? burn_weights.array(mfi) : Array4<Real>{};
 
-                if (reactions.contains(i,j,k)) {
-                    for (int n = 0; n < reactions.nComp(); n++) {
-                        reactions(i,j,k,n) = 0.0_rt;
-                    }
-                }
+            const bool mask_tile = mask_covered_zones && fine_mask_coverage_of(mfi) != fine_coverage::none;
 
-            }
+            auto mask = mask_tile ? mask_mf.const_array(mfi) : Array4<Real const>{};
 
 #if defined(AMREX_USE_GPU)
-            if (burn_failed) {
-                Gpu::Atomic::Add(p_num_failed, burn_failed);
-            }
+            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k)
+            {
+                int burn_failed = react_zone(i, j, k, U, reactions, weights, mask, mask_tile,
+                                             geomdata, time, dt, strang_half, lev);
+
+                if (burn_failed) {
+                    Gpu::Atomic::Add(p_num_failed, burn_failed);
+                }
+            });
 #else
-            num_failed += burn_failed;
+            LoopOnCpu(bx, [&] (int i, int j, int k)
+            {
+                num_failed += react_zone(i, j, k, U, reactions, weights, mask, mask_tile,
+                                         geomdata, time, dt, strang_half, lev);
+            });
 #endif
-        });
 
 #if defined(AMREX_USE_HIP)
-        Gpu::streamSynchronize(); // otherwise HIP may fail to allocate the necessary resources.
+            Gpu::streamSynchronize(); // otherwise HIP may fail to allocate the necessary resources.
 #endif
 
 #ifdef ALLOW_GPU_PRINTF
-        std::fflush(nullptr);
+            std::fflush(nullptr);
 #endif
 
+        }
+
     }
 
 #if defined(AMREX_USE_GPU)
@@ -560,7 +696,8 @@ Castro::react_state(Real time, Real dt)
         auto react_src = reactions.array(mfi);
         auto weights = store_burn_weights ? burn_weights.array(mfi) : Array4<Real>{};
         Array4<Real> empty_arr{};
-        const auto& mask = mask_covered_zones ? mask_mf.array(mfi) : empty_arr;
+        const bool mask_tile = mask_covered_zones && fine_mask_coverage_of(mfi) != fine_coverage::none;
+        const auto& mask = mask_tile ? mask_mf.array(mfi) : empty_arr;
 
         int lsdc_iteration = sdc_iteration;
 
@@ -607,7 +744,7 @@ Castro::react_state(Real time, Real dt)
 
             // Don't burn on zones that are masked out.
 
-            if (mask_covered_zones && mask.contains(i,j,k)) {
+            if (mask_tile && mask.contains(i,j,k)) {
                 if (mask(i,j,k) == 0.0_rt) {
                     do_burn = false;
                 }
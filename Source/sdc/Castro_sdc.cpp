@@ -179,11 +179,27 @@ Castro::do_sdc_update(int m_start, int m_end, Real dt)
             auto A_n = (*A_new[m_end]).array(mfi);
             auto C_arr = C2.array();
 
-            amrex::ParallelFor(bx,
-            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-            {
-                sdc_update_o2(i, j, k, k_m, k_n, A_m, A_n, C_arr, dt_m, sdc_iteration, m_start);
-            });
+            if (sdc_newton_batch && sdc_solver != VODE_SOLVE) {
+
+                sdc_batched_update(bx,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept -> bool
+                {
+                    return sdc_update_o2_first_attempt(i, j, k, k_m, k_n, A_m, A_n, C_arr, dt_m, sdc_iteration);
+                },
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                {
+                    sdc_update_o2_subdivided(i, j, k, k_m, k_n, C_arr, dt_m, sdc_iteration);
+                });
+
+            } else {
+
+                amrex::ParallelFor(bx,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                {
+                    sdc_update_o2(i, j, k, k_m, k_n, A_m, A_n, C_arr, dt_m, sdc_iteration, m_start);
+                });
+
+            }
         }
         else
         {
@@ -228,11 +244,29 @@ Castro::do_sdc_update(int m_start, int m_end, Real dt)
             // an average in Sburn
             make_cell_center(bx1, Sburn.array(mfi), U_new_center_arr, domain_lo, domain_hi);
 
-            amrex::ParallelFor(bx1,
-            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-            {
-                sdc_update_centers_o4(i, j, k, U_center_arr, U_new_center_arr, C_center_arr, dt_m, sdc_iteration);
-            });
+            if (sdc_newton_batch && sdc_solver != VODE_SOLVE) {
+
+                sdc_batched_update(bx1,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept -> bool
+                {
+                    return sdc_update_centers_o4_first_attempt(i, j, k, U_center_arr, U_new_center_arr, C_center_arr,
+                                                               dt_m, sdc_iteration);
+                },
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                {
+                    sdc_update_centers_o4_subdivided(i, j, k, U_center_arr, U_new_center_arr, C_center_arr,
+                                                     dt_m, sdc_iteration);
+                });
+
+            } else {
+
+                amrex::ParallelFor(bx1,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                {
+                    sdc_update_centers_o4(i, j, k, U_center_arr, U_new_center_arr, C_center_arr, dt_m, sdc_iteration);
+                });
+
+            }
 
             // enforce that the species sum to one after the reaction solve
             amrex::ParallelFor(bx1,
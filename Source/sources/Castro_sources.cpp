@@ -69,7 +69,7 @@ Castro::source_flag(int src)
 
 #ifdef DIFFUSION
     case diff_src:
-        if (diffuse_temp &&
+        if (diffuse_temp && !diffuse_sts &&
             !(time_integration_method == SpectralDeferredCorrections)) {
           return true;
         }
@@ -541,6 +541,10 @@ Castro::pre_advance_operators (Real time, Real dt)  // NOLINT(readability-conver
     construct_old_gravity(time);
 #endif
 
+    // Everything from here on needs the ghost zones of Sborder.
+
+    finish_Sborder_fill();
+
 #ifdef SHOCK_VAR
     // we want to compute the shock flag that will be used
     // (optionally) in disabling reactions in shocks.  We compute this
@@ -682,6 +686,15 @@ Castro::post_advance_operators (Real time, Real dt)  // NOLINT(readability-conve
 
     advance_status status {};
 
+#ifdef DIFFUSION
+    // Super-time-stepped thermal diffusion is split from the hydro
+    // and sources, and done before the second half of the burn.
+
+    if (diffuse_temp && diffuse_sts) {
+        do_sts_diffusion(time, dt);
+    }
+#endif
+
 #ifndef TRUE_SDC
 #ifdef REACTIONS
     status = do_new_reactions(time, dt);